@@ -0,0 +1,190 @@
+#include "BenchmarkWorld.hpp"
+#include "../Engine/Engine.hpp"
+#include <algorithm>
+#include <cstdlib>
+
+namespace BenchmarkWorld
+{
+    using FNameChar = std::remove_const_t<FName::ElementType>;
+    using FStringChar = std::remove_const_t<FString::ElementType>;
+
+    static TArray<class FNameEntry*>* m_names = nullptr;
+    static TArray<class UObject*>* m_objects = nullptr;
+    static std::unordered_map<std::string, int32_t> m_nameIds;
+    static std::unordered_map<std::string, class UClass*> m_coreClasses;
+    static class UObject* m_corePackage = nullptr;
+    static size_t m_packageCount = 0;
+
+    static FName CreateName(const std::string& name)
+    {
+        auto nameIt = m_nameIds.find(name);
+
+        if (nameIt != m_nameIds.end())
+        {
+            return FName(nameIt->second);
+        }
+
+        // Only allocated as big as the name needs, the same way the engine does it, since most of "Name" goes unused.
+        size_t entrySize = ((sizeof(FNameEntry) - sizeof(FNameEntry::Name)) + ((name.length() + 1) * sizeof(FNameChar)));
+        FNameEntry* nameEntry = static_cast<FNameEntry*>(std::calloc(1, entrySize));
+        nameEntry->Index = m_names->size();
+        std::copy(name.begin(), name.end(), nameEntry->Name);
+
+        m_names->push_back(nameEntry);
+        m_nameIds[name] = nameEntry->Index;
+        return FName(nameEntry->Index);
+    }
+
+    static FStringChar* CreateString(const std::string& str)
+    {
+        FStringChar* stringData = static_cast<FStringChar*>(std::calloc((str.length() + 1), sizeof(FStringChar)));
+        std::copy(str.begin(), str.end(), stringData);
+        return stringData;
+    }
+
+    template<typename T> T* CreateObject(const std::string& name, class UObject* outer, class UClass* uClass)
+    {
+        T* uObject = static_cast<T*>(std::calloc(1, sizeof(T)));
+        uObject->ObjectInternalInteger = m_objects->size();
+        uObject->Outer = outer;
+        uObject->Name = CreateName(name);
+        uObject->Class = uClass;
+        m_objects->push_back(uObject);
+        return uObject;
+    }
+
+    template<typename T> T* CreateProperty(const std::string& className, const std::string& name, class UStruct* outer, int32_t offset, int32_t size, uint64_t propertyFlags)
+    {
+        T* uProperty = CreateObject<T>(name, outer, m_coreClasses[className]);
+        uProperty->ArrayDim = 1;
+        uProperty->ElementSize = size;
+        uProperty->PropertyFlags = propertyFlags;
+        uProperty->Offset = offset;
+        return uProperty;
+    }
+
+    static class UClass* CreateCoreClass(const std::string& name, const std::string& superName, int32_t size)
+    {
+        class UClass* uClass = CreateObject<UClass>(name, m_corePackage, m_coreClasses["Class"]);
+        uClass->SuperField = (superName.empty() ? nullptr : m_coreClasses[superName]);
+        uClass->PropertySize = size;
+        m_coreClasses[name] = uClass;
+        return uClass;
+    }
+
+    static void LinkChildren(class UStruct* uStruct, const std::vector<class UField*>& children)
+    {
+        class UField** nextField = &uStruct->Children;
+
+        for (class UField* uField : children)
+        {
+            *nextField = uField;
+            nextField = &uField->Next;
+        }
+    }
+
+    void Initialize()
+    {
+        if (!m_objects)
+        {
+            m_names = new TArray<class FNameEntry*>();
+            m_objects = new TArray<class UObject*>();
+            CreateName("None");
+
+            // "Class" is its own class, and "Core" can only get its class once "Package" exists.
+            m_corePackage = CreateObject<UObject>("Core", nullptr, nullptr);
+            class UClass* metaClass = CreateObject<UClass>("Class", m_corePackage, nullptr);
+            metaClass->Class = metaClass;
+            m_coreClasses["Class"] = metaClass;
+
+            CreateCoreClass("Object", "", sizeof(UObject));
+            m_corePackage->Class = CreateCoreClass("Package", "Object", sizeof(UObject));
+            CreateCoreClass("Field", "Object", sizeof(UField));
+            CreateCoreClass("Enum", "Field", sizeof(UEnum));
+            CreateCoreClass("Const", "Field", sizeof(UConst));
+            CreateCoreClass("Property", "Field", sizeof(UProperty));
+            CreateCoreClass("Struct", "Field", sizeof(UStruct));
+            CreateCoreClass("Function", "Struct", sizeof(UFunction));
+            CreateCoreClass("ScriptStruct", "Struct", sizeof(UScriptStruct));
+            CreateCoreClass("State", "Struct", sizeof(UState));
+            metaClass->SuperField = m_coreClasses["State"];
+            metaClass->PropertySize = sizeof(UClass);
+
+            CreateCoreClass("StructProperty", "Property", sizeof(UStructProperty));
+            CreateCoreClass("StrProperty", "Property", sizeof(UStrProperty));
+            CreateCoreClass("QWordProperty", "Property", sizeof(UQWordProperty));
+            CreateCoreClass("SQWordProperty", "Property", sizeof(USQWordProperty));
+            CreateCoreClass("ObjectProperty", "Property", sizeof(UObjectProperty));
+            CreateCoreClass("ClassProperty", "ObjectProperty", sizeof(UClassProperty));
+            CreateCoreClass("ComponentProperty", "ObjectProperty", sizeof(UComponentProperty));
+            CreateCoreClass("InterfaceProperty", "Property", sizeof(UInterfaceProperty));
+            CreateCoreClass("NameProperty", "Property", sizeof(UNameProperty));
+            CreateCoreClass("MapProperty", "Property", sizeof(UMapProperty));
+            CreateCoreClass("IntProperty", "Property", sizeof(UIntProperty));
+            CreateCoreClass("FloatProperty", "Property", sizeof(UFloatProperty));
+            CreateCoreClass("DelegateProperty", "Property", sizeof(UDelegateProperty));
+            CreateCoreClass("ByteProperty", "Property", sizeof(UByteProperty));
+            CreateCoreClass("BoolProperty", "Property", sizeof(UBoolProperty));
+            CreateCoreClass("ArrayProperty", "Property", sizeof(UArrayProperty));
+
+            m_objects->push_back(nullptr); // The generator never looks at the last object, the same as the engine's own array.
+            GObjects = m_objects;
+            GNames = m_names;
+        }
+    }
+
+    void AddPackage(size_t groupCount)
+    {
+        if (m_objects)
+        {
+            m_objects->pop_back();
+
+            std::string packageName = ("BenchmarkPackage" + std::to_string(m_packageCount++));
+            class UObject* uPackage = CreateObject<UObject>(packageName, nullptr, m_coreClasses["Package"]);
+            int32_t objectSize = static_cast<int32_t>(sizeof(UObject));
+
+            for (size_t groupIndex = 0; groupIndex < groupCount; groupIndex++)
+            {
+                std::string groupName = (packageName + "_" + std::to_string(groupIndex));
+
+                class UClass* uClass = CreateObject<UClass>(("BenchmarkClass" + groupName), uPackage, m_coreClasses["Class"]);
+                uClass->SuperField = m_coreClasses["Object"];
+                uClass->PropertySize = (objectSize + 8);
+
+                class UFunction* uFunction = CreateObject<UFunction>("BenchmarkFunction", uClass, m_coreClasses["Function"]);
+                uFunction->FunctionFlags = FUNC_Event;
+                uFunction->PropertySize = 4;
+                LinkChildren(uFunction, { CreateProperty<UFloatProperty>("FloatProperty", "DeltaTime", uFunction, 0, 4, CPF_Parm) });
+
+                LinkChildren(uClass, {
+                    CreateProperty<UIntProperty>("IntProperty", "Health", uClass, objectSize, 4, CPF_Edit),
+                    CreateProperty<UFloatProperty>("FloatProperty", "Speed", uClass, (objectSize + 4), 4, 0),
+                    uFunction
+                });
+
+                class UScriptStruct* uScriptStruct = CreateObject<UScriptStruct>(("BenchmarkStruct" + groupName), uClass, m_coreClasses["ScriptStruct"]);
+                uScriptStruct->PropertySize = 8;
+                uScriptStruct->MinAlignment = 4;
+
+                LinkChildren(uScriptStruct, {
+                    CreateProperty<UIntProperty>("IntProperty", "Item", uScriptStruct, 0, 4, 0),
+                    CreateProperty<UFloatProperty>("FloatProperty", "Weight", uScriptStruct, 4, 4, 0)
+                });
+
+                class UEnum* uEnum = CreateObject<UEnum>(("EBenchmarkEnum" + groupName), uClass, m_coreClasses["Enum"]);
+                uEnum->Names.push_back(CreateName("BENCHMARK_None"));
+                uEnum->Names.push_back(CreateName("BENCHMARK_" + groupName));
+
+                class UConst* uConst = CreateObject<UConst>(("BENCHMARK_CONST_" + groupName), uClass, m_coreClasses["Const"]);
+                uConst->Value.assign(CreateString(std::to_string(groupIndex)));
+            }
+
+            m_objects->push_back(nullptr);
+        }
+    }
+
+    size_t GetObjectCount()
+    {
+        return (m_objects ? static_cast<size_t>(m_objects->size() - 1) : 0);
+    }
+}
\ No newline at end of file
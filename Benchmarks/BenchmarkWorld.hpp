@@ -0,0 +1,22 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+
+/*
+# ========================================================================================= #
+# Benchmark World
+# ========================================================================================= #
+*/
+
+// Synthetic GObjects and GNames for the benchmarks that time the generator itself, laid out the same way the engine classes in "GameDefines.hpp" are.
+// Core holds the engine classes every "StaticClass" looks up, every other package is a batch of groups that each have a class, a struct, an enum and a const.
+// Objects are never freed, they're all allocated once and have to outlive the generators caches anyway.
+
+namespace BenchmarkWorld
+{
+	static constexpr size_t OBJECTS_PER_GROUP = 10; // A class with two properties and a function with a parameter, a struct with two properties, an enum and a const.
+
+	void Initialize(); // Creates the core package and points GObjects and GNames at the synthetic arrays.
+	void AddPackage(size_t groupCount);
+	size_t GetObjectCount();
+}
\ No newline at end of file
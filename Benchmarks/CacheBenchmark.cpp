@@ -0,0 +1,98 @@
+#include "BenchmarkWorld.hpp"
+#include "../dllmain.hpp"
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <cstdlib>
+
+/*
+# ========================================================================================= #
+# Cache Benchmark
+# ========================================================================================= #
+*/
+
+// Times "GCache::Initialize" over a synthetic GObjects that keeps growing, to show how building the cache scales with the object count.
+// Deduplicating through hash sets should keep the time per object flat, where the linear searches it replaced grew with every object already cached.
+// Besides whatever gets cached from Core, every size has to cache exactly one const, enum, struct and class per group, any more or less means objects were merged or duplicated.
+// Usage is "CacheBenchmark [largest object count]", the default is 400000, each size before it is half of the next.
+
+static constexpr size_t DEFAULT_OBJECT_COUNT = 400000;
+static constexpr size_t BENCHMARK_SIZES = 5;
+static constexpr size_t GROUPS_PER_PACKAGE = 1000;
+static constexpr size_t CACHED_PER_GROUP = 4; // Only the class, struct, enum and const of each group get cached.
+static constexpr uint32_t BENCHMARK_RUNS = 3; // Only the fastest run of each size is reported.
+
+// Returns how long the fastest run took in milliseconds, the cache is cleared before every run so each one builds it from nothing.
+static double TimeInitialize()
+{
+    double fastest = 0.0;
+
+    for (uint32_t run = 0; run < BENCHMARK_RUNS; run++)
+    {
+        GCache::ClearCache();
+        std::chrono::time_point startTime = std::chrono::steady_clock::now();
+        GCache::Initialize();
+        double elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+
+        if ((run == 0) || (elapsed < fastest))
+        {
+            fastest = elapsed;
+        }
+    }
+
+    return fastest;
+}
+
+int main(int argc, char** argv)
+{
+    size_t largestCount = ((argc > 1) ? std::strtoull(argv[1], nullptr, 10) : DEFAULT_OBJECT_COUNT);
+
+    if (largestCount == 0)
+    {
+        std::cerr << "Usage: " << argv[0] << " [largest object count]" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    BenchmarkWorld::Initialize();
+    GCache::Initialize();
+    size_t coreCount = GCache::GetObjectCount();
+    size_t groupCount = 0;
+    bool bMismatched = false;
+
+    std::cout << "Building the cache with " << Utils::GetThreadCount() << " threads, fastest of " << BENCHMARK_RUNS << " runs.\n" << std::endl;
+    std::cout << "    " << std::setw(10) << "Objects" << std::setw(10) << "Cached" << std::setw(14) << "Time" << std::setw(14) << "Per object" << std::endl;
+
+    for (size_t sizeIndex = BENCHMARK_SIZES; sizeIndex > 0; sizeIndex--)
+    {
+        size_t targetCount = (largestCount >> (sizeIndex - 1));
+
+        while ((BenchmarkWorld::GetObjectCount() < targetCount) || (groupCount == 0))
+        {
+            BenchmarkWorld::AddPackage(GROUPS_PER_PACKAGE);
+            groupCount += GROUPS_PER_PACKAGE;
+        }
+
+        double elapsed = TimeInitialize();
+        size_t objectCount = BenchmarkWorld::GetObjectCount();
+        double perObject = ((elapsed * 1000000.0) / static_cast<double>(objectCount));
+
+        std::cout << "    " << std::setw(10) << objectCount << std::setw(10) << GCache::GetObjectCount();
+        std::cout << std::fixed << std::setprecision(2) << std::setw(11) << elapsed << " ms" << std::setw(11) << perObject << " ns";
+
+        if (GCache::GetObjectCount() != (coreCount + (groupCount * CACHED_PER_GROUP)))
+        {
+            std::cout << "    MISMATCH";
+            bMismatched = true;
+        }
+
+        std::cout << std::endl;
+    }
+
+    if (bMismatched)
+    {
+        std::cerr << "\nError: The cache didn't hold exactly one const, enum, struct and class per group!" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
\ No newline at end of file
@@ -0,0 +1,183 @@
+#include "../Framework/Scanner.hpp"
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <random>
+#include <functional>
+#include <cstring>
+#include <cstdlib>
+
+/*
+# ========================================================================================= #
+# Scanner Benchmark
+# ========================================================================================= #
+*/
+
+// Times every tier of "Scanner::Find" against the byte by byte loop "Retrievers::FindPattern" used before the scanner existed, on a synthetic module image.
+// The image is mostly made of bytes that are common in x64 code, so the rarest byte of a pattern still shows up often enough to keep the anchor checks busy.
+// Each pattern is planted near the end of the image so every search has to go through almost all of it, and every tier has to return the same match as the old loop.
+// Usage is "ScannerBenchmark [image size in megabytes]", the default is 64.
+
+static constexpr size_t DEFAULT_IMAGE_SIZE = 64;
+static constexpr uint32_t BENCHMARK_RUNS = 3; // Only the fastest run of each search is reported.
+
+struct FBenchmarkCase
+{
+    std::string Name;
+    std::vector<uint8_t> Pattern;
+    std::string Mask;
+    bool bPlanted;
+};
+
+// Copy of the old "Retrievers::FindPattern", without looking up the module first.
+static const uint8_t* FindPatternOld(const uint8_t* data, size_t size, const uint8_t* pattern, const std::string& mask)
+{
+    if (pattern && !mask.empty())
+    {
+        uintptr_t start = reinterpret_cast<uintptr_t>(data);
+        uintptr_t end = (start + size);
+
+        size_t currentPos = 0;
+        size_t maskLength = (mask.length() - 1);
+
+        for (uintptr_t retAddress = start; retAddress < end; retAddress++)
+        {
+            if (*reinterpret_cast<uint8_t*>(retAddress) == pattern[currentPos] || mask[currentPos] == '?')
+            {
+                if (currentPos == maskLength)
+                {
+                    return reinterpret_cast<const uint8_t*>(retAddress - maskLength);
+                }
+
+                currentPos++;
+            }
+            else
+            {
+                retAddress -= currentPos;
+                currentPos = 0;
+            }
+        }
+    }
+
+    return nullptr;
+}
+
+static std::vector<uint8_t> CreateImage(size_t size)
+{
+    static constexpr uint8_t COMMON_BYTES[] = { 0x00, 0xFF, 0x48, 0x8B, 0xCC, 0x89, 0x24, 0x0F, 0x44, 0x4C, 0xE8, 0x85 };
+    std::mt19937_64 generator(1);
+    std::vector<uint8_t> image(size);
+
+    for (uint8_t& imageByte : image)
+    {
+        uint64_t random = generator();
+        imageByte = (((random % 3) != 0) ? COMMON_BYTES[(random >> 8) % sizeof(COMMON_BYTES)] : static_cast<uint8_t>(random >> 16));
+    }
+
+    return image;
+}
+
+// Returns how long the fastest run took in milliseconds, along with what the search found.
+static double TimeSearch(const std::function<const uint8_t*()>& search, const uint8_t*& result)
+{
+    double fastest = 0.0;
+
+    for (uint32_t run = 0; run < BENCHMARK_RUNS; run++)
+    {
+        std::chrono::time_point startTime = std::chrono::steady_clock::now();
+        result = search();
+        double elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+
+        if ((run == 0) || (elapsed < fastest))
+        {
+            fastest = elapsed;
+        }
+    }
+
+    return fastest;
+}
+
+int main(int argc, char** argv)
+{
+    size_t imageSize = (((argc > 1) ? std::strtoull(argv[1], nullptr, 10) : DEFAULT_IMAGE_SIZE) << 20);
+
+    if (imageSize == 0)
+    {
+        std::cerr << "Usage: " << argv[0] << " [image size in megabytes]" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    std::vector<FBenchmarkCase> benchmarkCases = {
+        { "Typical (48 8B 05 ?? ?? ?? ?? 48 8B 0C C8)", { 0x48, 0x8B, 0x05, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8B, 0x0C, 0xC8 }, "xxx????xxxx", true },
+        { "Only common bytes (48 8B 44 24 ?? 48 89 4C 24)", { 0x48, 0x8B, 0x44, 0x24, 0x00, 0x48, 0x89, 0x4C, 0x24 }, "xxxx?xxxx", true },
+        { "Repeated prefix (48 8B 48 8B 48 8B 48 8B 5D)", { 0x48, 0x8B, 0x48, 0x8B, 0x48, 0x8B, 0x48, 0x8B, 0x5D }, "xxxxxxxxx", true },
+        { "Not found (E8 ?? ?? ?? ?? 5B 5B 5B 5B 5B 5B)", { 0xE8, 0x00, 0x00, 0x00, 0x00, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B }, "x????xxxxxx", false }
+    };
+
+    std::vector<std::pair<std::string, std::function<const uint8_t*(const uint8_t*, size_t, const uint8_t*, const std::string&)>>> searches = {
+        { "Old", FindPatternOld },
+        { "Scalar", Scanner::FindScalar }
+    };
+
+    if (Scanner::HasSSE2())
+    {
+        searches.emplace_back("SSE2", Scanner::FindSSE2);
+    }
+
+    if (Scanner::HasAVX2())
+    {
+        searches.emplace_back("AVX2", Scanner::FindAVX2);
+    }
+
+    searches.emplace_back("Find", Scanner::Find);
+
+    std::vector<uint8_t> image = CreateImage(imageSize);
+    bool bMismatched = false;
+    std::cout << "Scanning a " << (imageSize >> 20) << " MB synthetic image, fastest of " << BENCHMARK_RUNS << " runs." << std::endl;
+
+    for (const FBenchmarkCase& benchmarkCase : benchmarkCases)
+    {
+        if (benchmarkCase.bPlanted)
+        {
+            std::memcpy(&image[image.size() - 4096], benchmarkCase.Pattern.data(), benchmarkCase.Pattern.size());
+        }
+
+        const uint8_t* expected = nullptr;
+        std::cout << "\n" << benchmarkCase.Name << std::endl;
+
+        for (const auto& search : searches)
+        {
+            const uint8_t* result = nullptr;
+            double elapsed = TimeSearch([&]() { return search.second(image.data(), image.size(), benchmarkCase.Pattern.data(), benchmarkCase.Mask); }, result);
+            double throughput = ((elapsed > 0.0) ? ((static_cast<double>(imageSize) / (1 << 20)) / (elapsed / 1000.0)) : 0.0);
+
+            if (search.first == "Old")
+            {
+                expected = result;
+            }
+
+            std::cout << "    " << std::left << std::setw(8) << search.first << std::right << std::fixed << std::setprecision(2) << std::setw(10) << elapsed << " ms" << std::setw(10) << std::setprecision(0) << throughput << " MB/s";
+
+            if (result != expected)
+            {
+                std::cout << "    MISMATCH";
+                bMismatched = true;
+            }
+
+            std::cout << std::endl;
+        }
+
+        if (benchmarkCase.bPlanted)
+        {
+            std::memset(&image[image.size() - 4096], 0, benchmarkCase.Pattern.size()); // So the next case can't find this one instead.
+        }
+    }
+
+    if (bMismatched)
+    {
+        std::cerr << "\nError: At least one search didn't find the same match as the old loop!" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
\ No newline at end of file
@@ -0,0 +1,314 @@
+#include "../Framework/Printer.hpp"
+#include "../Engine/Engine.hpp"
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <random>
+#include <functional>
+#include <cstdlib>
+
+/*
+# ========================================================================================= #
+# Text Buffer Benchmark
+# ========================================================================================= #
+*/
+
+// Times generating class members into "TextBuffer" through "Printer" against the "std::ostringstream" and "std::setw" path the generators used before it.
+// The object graph is synthetic, every class gets a random mix of property types, names, offsets and flags, and both paths print it the same way "ClassGenerator" does.
+// Each class is printed into its own buffer and then joined into one string, the same way "Utils::GenerateInOrder" does, and both results have to be byte for byte the same.
+// Usage is "TextBufferBenchmark [class count]", the default is 20000 classes with 32 properties each.
+
+static constexpr size_t DEFAULT_CLASS_COUNT = 20000;
+static constexpr size_t PROPERTIES_PER_CLASS = 32;
+static constexpr uint32_t BENCHMARK_RUNS = 3; // Only the fastest run of each path is reported.
+
+struct FBenchmarkProperty
+{
+    std::string Type;
+    std::string Name;
+    std::string Flags;
+    uintptr_t Offset;
+    uintptr_t Size;
+    uint64_t PropertyFlags;
+    uint32_t BitMask; // Only set for bool properties.
+};
+
+struct FBenchmarkClass
+{
+    std::string Name;
+    std::string SuperName;
+    std::string FullName;
+    uintptr_t Size;
+    uintptr_t SuperSize;
+    std::vector<FBenchmarkProperty> Properties;
+};
+
+// Copy of the old stream based "Printer" functions.
+namespace PrinterOld
+{
+    static constexpr uint32_t MAX_FILL_LENGTH = 1024;
+
+    void FillRight(std::ostringstream& stream, char fill, uint32_t width)
+    {
+        if (width > MAX_FILL_LENGTH)
+        {
+            width = MAX_FILL_LENGTH;
+        }
+
+        stream << std::setfill(fill) << std::setw(width) << std::right;
+    }
+
+    void FillLeft(std::ostringstream& stream, char fill, uint32_t width)
+    {
+        if (width > MAX_FILL_LENGTH)
+        {
+            width = MAX_FILL_LENGTH;
+        }
+
+        stream << std::setfill(fill) << std::setw(width) << std::left;
+    }
+
+    std::string Hex(uintptr_t decimal, uint32_t width)
+    {
+        std::ostringstream stream;
+        stream << "0x" << std::setfill('0') << std::setw(width) << std::right << std::uppercase << std::hex << decimal;
+        return stream.str();
+    }
+
+    std::string Hex(uintptr_t decimal, EWidthTypes width)
+    {
+        return Hex(decimal, static_cast<uint32_t>(width));
+    }
+}
+
+static std::vector<FBenchmarkClass> CreateClasses(size_t classCount)
+{
+    static const std::vector<std::string> PROPERTY_TYPES = { "int32_t", "float", "uint8_t", "class FString", "class FName", "class UObject*", "struct FVector", "class TArray<class UObject*>", "uint32_t" };
+    static const std::vector<std::string> PROPERTY_FLAGS = { "(CPF_Edit)", "(CPF_Edit | CPF_Net)", "(CPF_Transient | CPF_Native)", "(CPF_Const | CPF_EditConst | CPF_NoExport)", "" };
+    std::mt19937_64 generator(1);
+    std::vector<FBenchmarkClass> classes(classCount);
+
+    for (size_t classIndex = 0; classIndex < classCount; classIndex++)
+    {
+        FBenchmarkClass& benchmarkClass = classes[classIndex];
+        benchmarkClass.Name = ("UBenchmarkClass" + std::to_string(classIndex));
+        benchmarkClass.SuperName = ((classIndex > 0) ? classes[classIndex - 1].Name : "UObject");
+        benchmarkClass.FullName = ("Class BenchmarkPackage.BenchmarkClass" + std::to_string(classIndex));
+        benchmarkClass.SuperSize = ((classIndex > 0) ? classes[classIndex - 1].Size : 0x60);
+
+        uintptr_t offset = benchmarkClass.SuperSize;
+
+        for (size_t propertyIndex = 0; propertyIndex < PROPERTIES_PER_CLASS; propertyIndex++)
+        {
+            uint64_t random = generator();
+            FBenchmarkProperty property;
+            bool bBool = ((random % 8) == 0);
+
+            property.Type = (bBool ? "uint32_t" : PROPERTY_TYPES[(random >> 8) % PROPERTY_TYPES.size()]);
+            property.Name = ((bBool ? "bBenchmarkFlag" : "BenchmarkProperty") + std::to_string(propertyIndex) + (bBool ? " : 1" : ""));
+            property.Flags = PROPERTY_FLAGS[(random >> 16) % PROPERTY_FLAGS.size()];
+            property.Offset = offset;
+            property.Size = (bBool ? 4 : (4 << ((random >> 24) % 3)));
+            property.PropertyFlags = (random >> 32);
+            property.BitMask = (bBool ? (1u << ((random >> 40) % 32)) : 0);
+
+            offset += property.Size;
+            benchmarkClass.Properties.push_back(property);
+        }
+
+        benchmarkClass.Size = offset;
+    }
+
+    return classes;
+}
+
+// Prints a class the way "ClassGenerator::GenerateClass" did before "TextBuffer" existed.
+static void GenerateClassOld(std::ostringstream& classStream, const FBenchmarkClass& benchmarkClass)
+{
+    classStream << "// " << benchmarkClass.FullName << "\n";
+    classStream << "// " << PrinterOld::Hex((benchmarkClass.Size - benchmarkClass.SuperSize), EWidthTypes::Size);
+    classStream << " (" << PrinterOld::Hex(benchmarkClass.SuperSize, EWidthTypes::Size) << " - " << PrinterOld::Hex(benchmarkClass.Size, EWidthTypes::Size) << ")\n";
+    classStream << "class " << benchmarkClass.Name << " : public " << benchmarkClass.SuperName << "\n{\npublic:\n";
+
+    for (const FBenchmarkProperty& property : benchmarkClass.Properties)
+    {
+        classStream << "\t";
+        PrinterOld::FillLeft(classStream, ' ', GConfig::GetClassSpacing());
+        classStream << property.Type << " " << property.Name << ";";
+
+        uint32_t propSpacing = (property.Name.length() + 1);
+
+        if (propSpacing < GConfig::GetClassSpacing())
+        {
+            PrinterOld::FillRight(classStream, ' ', (GConfig::GetClassSpacing() - propSpacing));
+        }
+
+        classStream << "// " << PrinterOld::Hex(property.Offset, EWidthTypes::Size);
+        classStream << " (" << PrinterOld::Hex(property.Size, EWidthTypes::Size) << ")";
+        classStream << " [" << PrinterOld::Hex(property.PropertyFlags, EWidthTypes::PropertyFlags) << "] ";
+
+        if (property.BitMask != 0)
+        {
+            classStream << "[" << PrinterOld::Hex(property.BitMask, EWidthTypes::BitMask) << "] ";
+        }
+        else
+        {
+            PrinterOld::FillLeft(classStream, ' ', static_cast<size_t>(EWidthTypes::FieldWidth));
+        }
+
+        classStream << property.Flags << "\n";
+    }
+
+    classStream << "};\n\n";
+}
+
+// Prints a class the way "ClassGenerator::GenerateClass" does now.
+static void GenerateClassNew(TextBuffer& classStream, const FBenchmarkClass& benchmarkClass)
+{
+    Printer::NumberBuffer numberBuffer;
+    classStream << "// " << benchmarkClass.FullName << "\n";
+    classStream << "// " << Printer::Hex(numberBuffer, (benchmarkClass.Size - benchmarkClass.SuperSize), EWidthTypes::Size);
+    classStream << " (" << Printer::Hex(numberBuffer, benchmarkClass.SuperSize, EWidthTypes::Size) << " - ";
+    classStream << Printer::Hex(numberBuffer, benchmarkClass.Size, EWidthTypes::Size) << ")\n";
+    classStream << "class " << benchmarkClass.Name << " : public " << benchmarkClass.SuperName << "\n{\npublic:\n";
+
+    for (const FBenchmarkProperty& property : benchmarkClass.Properties)
+    {
+        classStream << "\t";
+        Printer::FillLeft(classStream, ' ', GConfig::GetClassSpacing());
+        classStream << property.Type << " " << property.Name << ";";
+
+        uint32_t propSpacing = (property.Name.length() + 1);
+
+        if (propSpacing < GConfig::GetClassSpacing())
+        {
+            Printer::FillRight(classStream, ' ', (GConfig::GetClassSpacing() - propSpacing));
+        }
+
+        classStream << "// " << Printer::Hex(numberBuffer, property.Offset, EWidthTypes::Size);
+        classStream << " (" << Printer::Hex(numberBuffer, property.Size, EWidthTypes::Size) << ")";
+        classStream << " [" << Printer::Hex(numberBuffer, property.PropertyFlags, EWidthTypes::PropertyFlags) << "] ";
+
+        if (property.BitMask != 0)
+        {
+            classStream << "[" << Printer::Hex(numberBuffer, property.BitMask, EWidthTypes::BitMask) << "] ";
+        }
+        else
+        {
+            Printer::FillLeft(classStream, ' ', static_cast<size_t>(EWidthTypes::FieldWidth));
+        }
+
+        classStream << property.Flags << "\n";
+    }
+
+    classStream << "};\n\n";
+}
+
+static std::string GenerateAllOld(const std::vector<FBenchmarkClass>& classes)
+{
+    std::vector<std::ostringstream> classStreams(classes.size());
+    std::string file;
+
+    for (size_t classIndex = 0; classIndex < classes.size(); classIndex++)
+    {
+        GenerateClassOld(classStreams[classIndex], classes[classIndex]);
+    }
+
+    for (const std::ostringstream& classStream : classStreams)
+    {
+        file += classStream.str();
+    }
+
+    return file;
+}
+
+static std::string GenerateAllNew(const std::vector<FBenchmarkClass>& classes)
+{
+    std::vector<TextBuffer> classStreams(classes.size());
+    std::string file;
+
+    for (size_t classIndex = 0; classIndex < classes.size(); classIndex++)
+    {
+        GenerateClassNew(classStreams[classIndex], classes[classIndex]);
+    }
+
+    for (const TextBuffer& classStream : classStreams)
+    {
+        file += classStream.str();
+    }
+
+    return file;
+}
+
+// Returns how long the fastest run took in milliseconds, along with what the last run printed.
+static double TimeGenerate(const std::function<std::string()>& generate, std::string& result)
+{
+    double fastest = 0.0;
+
+    for (uint32_t run = 0; run < BENCHMARK_RUNS; run++)
+    {
+        std::chrono::time_point startTime = std::chrono::steady_clock::now();
+        result = generate();
+        double elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+
+        if ((run == 0) || (elapsed < fastest))
+        {
+            fastest = elapsed;
+        }
+    }
+
+    return fastest;
+}
+
+int main(int argc, char** argv)
+{
+    size_t classCount = ((argc > 1) ? std::strtoull(argv[1], nullptr, 10) : DEFAULT_CLASS_COUNT);
+
+    if (classCount == 0)
+    {
+        std::cerr << "Usage: " << argv[0] << " [class count]" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    std::vector<FBenchmarkClass> classes = CreateClasses(classCount);
+
+    std::vector<std::pair<std::string, std::function<std::string()>>> generators = {
+        { "Old", [&]() { return GenerateAllOld(classes); } },
+        { "New", [&]() { return GenerateAllNew(classes); } }
+    };
+
+    std::string expected;
+    bool bMismatched = false;
+    std::cout << "Printing " << classCount << " synthetic classes with " << PROPERTIES_PER_CLASS << " properties each, fastest of " << BENCHMARK_RUNS << " runs.\n" << std::endl;
+
+    for (const auto& generator : generators)
+    {
+        std::string result;
+        double elapsed = TimeGenerate(generator.second, result);
+        double throughput = ((elapsed > 0.0) ? ((static_cast<double>(result.size()) / (1 << 20)) / (elapsed / 1000.0)) : 0.0);
+
+        if (generator.first == "Old")
+        {
+            expected = result;
+        }
+
+        std::cout << "    " << std::left << std::setw(8) << generator.first << std::right << std::fixed << std::setprecision(2) << std::setw(10) << elapsed << " ms";
+        std::cout << std::setw(10) << (static_cast<double>(result.size()) / (1 << 20)) << " MB" << std::setw(10) << std::setprecision(0) << throughput << " MB/s";
+
+        if (result != expected)
+        {
+            std::cout << "    MISMATCH";
+            bMismatched = true;
+        }
+
+        std::cout << std::endl;
+    }
+
+    if (bMismatched)
+    {
+        std::cerr << "\nError: The text buffer didn't print the same text as the old streams!" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
\ No newline at end of file
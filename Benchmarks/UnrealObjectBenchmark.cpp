@@ -0,0 +1,153 @@
+#include "BenchmarkWorld.hpp"
+#include "../dllmain.hpp"
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <random>
+#include <functional>
+#include <unordered_set>
+#include <cstdlib>
+
+/*
+# ========================================================================================= #
+# Unreal Object Benchmark
+# ========================================================================================= #
+*/
+
+// Times sorting cached "UnrealObject"s by the hash they precompute against the string "Hash" they used to build every time two of them were compared.
+// The objects come from running "GCache" over a synthetic world, so they're the same consts, enums, structs and classes the generators would sort.
+// Both sorts have to come out ordered by their own key, and the precomputed hashes have to tell apart exactly as many objects as the old strings did.
+// Usage is "UnrealObjectBenchmark [object count]", the default is 100000.
+
+static constexpr size_t DEFAULT_OBJECT_COUNT = 100000;
+static constexpr size_t GROUPS_PER_PACKAGE = 1000;
+static constexpr size_t CACHED_PER_GROUP = 4; // Only the class, struct, enum and const of each group get cached.
+static constexpr uint32_t BENCHMARK_RUNS = 3; // Only the fastest run of each sort is reported.
+
+// Copy of the old "UnrealObject::Hash".
+static std::string HashOld(const UnrealObject& unrealObj)
+{
+    if (unrealObj.IsValid())
+    {
+        return (std::to_string(static_cast<int32_t>(unrealObj.Type)) + "." + unrealObj.FullName + "." + unrealObj.ValidName);
+    }
+
+    return "";
+}
+
+static std::vector<UnrealObject> GetCachedObjects(size_t objectCount)
+{
+    std::vector<UnrealObject> cachedObjects;
+
+    for (const UnrealObject& packageObj : *GCache::GetPackages())
+    {
+        for (EClassTypes type : { EClassTypes::UConst, EClassTypes::UEnum, EClassTypes::UStruct, EClassTypes::UClass })
+        {
+            std::vector<UnrealObject>* objCache = GCache::GetCache(packageObj.Object, type);
+            cachedObjects.insert(cachedObjects.end(), objCache->begin(), objCache->end());
+        }
+    }
+
+    if (cachedObjects.size() > objectCount)
+    {
+        cachedObjects.resize(objectCount);
+    }
+
+    std::shuffle(cachedObjects.begin(), cachedObjects.end(), std::mt19937_64(1)); // Cached in GObjects order, which the old strings would already be mostly sorted by.
+    return cachedObjects;
+}
+
+// Returns how long the fastest run took in milliseconds, every run sorts its own copy so none of them start out sorted.
+static double TimeSort(const std::vector<UnrealObject>& objects, const std::function<void(std::vector<UnrealObject>&)>& sort, std::vector<UnrealObject>& result)
+{
+    double fastest = 0.0;
+
+    for (uint32_t run = 0; run < BENCHMARK_RUNS; run++)
+    {
+        result = objects;
+        std::chrono::time_point startTime = std::chrono::steady_clock::now();
+        sort(result);
+        double elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+
+        if ((run == 0) || (elapsed < fastest))
+        {
+            fastest = elapsed;
+        }
+    }
+
+    return fastest;
+}
+
+int main(int argc, char** argv)
+{
+    size_t objectCount = ((argc > 1) ? std::strtoull(argv[1], nullptr, 10) : DEFAULT_OBJECT_COUNT);
+
+    if (objectCount == 0)
+    {
+        std::cerr << "Usage: " << argv[0] << " [object count]" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    BenchmarkWorld::Initialize();
+
+    for (size_t groupCount = 0; groupCount < ((objectCount + CACHED_PER_GROUP - 1) / CACHED_PER_GROUP); groupCount += GROUPS_PER_PACKAGE)
+    {
+        BenchmarkWorld::AddPackage(GROUPS_PER_PACKAGE);
+    }
+
+    GCache::Initialize();
+    std::vector<UnrealObject> objects = GetCachedObjects(objectCount);
+
+    std::vector<std::pair<std::string, std::function<void(std::vector<UnrealObject>&)>>> sorts = {
+        { "Old", [](std::vector<UnrealObject>& unrealObjs) { std::sort(unrealObjs.begin(), unrealObjs.end(), [](const UnrealObject& a, const UnrealObject& b) { return (HashOld(a) < HashOld(b)); }); } },
+        { "New", [](std::vector<UnrealObject>& unrealObjs) { std::sort(unrealObjs.begin(), unrealObjs.end()); } }
+    };
+
+    std::cout << "Sorting " << objects.size() << " cached objects out of " << BenchmarkWorld::GetObjectCount() << " in GObjects, fastest of " << BENCHMARK_RUNS << " runs.\n" << std::endl;
+    bool bMismatched = false;
+
+    for (const auto& sort : sorts)
+    {
+        std::vector<UnrealObject> result;
+        double elapsed = TimeSort(objects, sort.second, result);
+        bool bSorted = false;
+
+        if (sort.first == "Old")
+        {
+            bSorted = std::is_sorted(result.begin(), result.end(), [](const UnrealObject& a, const UnrealObject& b) { return (HashOld(a) < HashOld(b)); });
+        }
+        else
+        {
+            bSorted = std::is_sorted(result.begin(), result.end());
+        }
+
+        std::cout << "    " << std::left << std::setw(8) << sort.first << std::right << std::fixed << std::setprecision(2) << std::setw(10) << elapsed << " ms";
+
+        if (!bSorted || (result.size() != objects.size()))
+        {
+            std::cout << "    NOT SORTED";
+            bMismatched = true;
+        }
+
+        std::cout << std::endl;
+    }
+
+    std::unordered_set<std::string> oldHashes;
+    std::unordered_set<uint64_t> newHashes;
+
+    for (const UnrealObject& unrealObj : objects)
+    {
+        oldHashes.insert(HashOld(unrealObj));
+        newHashes.insert(unrealObj.Hash());
+    }
+
+    std::cout << "\n    " << oldHashes.size() << " unique old hashes, " << newHashes.size() << " unique new hashes." << std::endl;
+
+    if (bMismatched || (oldHashes.size() != newHashes.size()))
+    {
+        std::cerr << "\nError: The precomputed hashes didn't sort or tell objects apart the same way the old strings did!" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
\ No newline at end of file
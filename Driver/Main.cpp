@@ -0,0 +1,98 @@
+#include "../dllmain.hpp"
+#include <sys/wait.h>
+#include <unistd.h>
+
+/*
+# ========================================================================================= #
+# Offline Driver
+# ========================================================================================= #
+*/
+
+// Generates an sdk for every heap image given on the command line, without the game running or even being on the same machine.
+// All of the generators state is global, so instead of resetting it between images each one is generated in its own forked process.
+// Each sdk is written to "<output directory>/<image name>/<GameNameShort>", so images for different versions of a game don't overwrite each other.
+
+static int32_t GenerateImage(const std::filesystem::path& outputDirectory, const std::filesystem::path& imageFile)
+{
+    GConfig::SetOutputPath(outputDirectory / imageFile.stem());
+    std::filesystem::create_directories(GConfig::GetOutputPath());
+    return (Generator::GenerateSnapshotSDK(imageFile) ? EXIT_SUCCESS : EXIT_FAILURE);
+}
+
+// Waits for any one of the running processes to exit, returns true if it generated its sdk.
+static bool WaitForImage(std::map<pid_t, std::filesystem::path>& processes)
+{
+    int32_t status = 0;
+    pid_t processId = wait(&status);
+    auto processIt = processes.find(processId);
+
+    if (processIt != processes.end())
+    {
+        bool bGenerated = (WIFEXITED(status) && (WEXITSTATUS(status) == EXIT_SUCCESS));
+
+        if (!bGenerated)
+        {
+            std::cerr << "Error: Failed to generate an sdk from \"" << processIt->second.string() << "\"!" << std::endl;
+        }
+
+        processes.erase(processIt);
+        return bGenerated;
+    }
+
+    return false;
+}
+
+int main(int argc, char** argv)
+{
+    if (argc < 3)
+    {
+        std::cerr << "Usage: " << argv[0] << " <output directory> <heap image> [heap image...]" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    std::filesystem::path outputDirectory = argv[1];
+    std::map<pid_t, std::filesystem::path> processes;
+    size_t maxProcesses = std::thread::hardware_concurrency();
+    int32_t failedImages = 0;
+
+    if (maxProcesses == 0)
+    {
+        maxProcesses = 1;
+    }
+
+    for (int32_t i = 2; i < argc; i++)
+    {
+        std::filesystem::path imageFile = argv[i];
+
+        if (processes.size() >= maxProcesses)
+        {
+            failedImages += (WaitForImage(processes) ? 0 : 1);
+        }
+
+        std::cout.flush(); // Otherwise anything still buffered gets printed again by the child.
+        pid_t processId = fork();
+
+        if (processId == 0)
+        {
+            int32_t result = GenerateImage(outputDirectory, imageFile);
+            std::cout.flush();
+            _exit(result);
+        }
+        else if (processId > 0)
+        {
+            processes[processId] = imageFile;
+        }
+        else
+        {
+            std::cerr << "Error: Failed to start a process for \"" << imageFile.string() << "\"!" << std::endl;
+            failedImages++;
+        }
+    }
+
+    while (!processes.empty())
+    {
+        failedImages += (WaitForImage(processes) ? 0 : 1);
+    }
+
+    return ((failedImages == 0) ? EXIT_SUCCESS : EXIT_FAILURE);
+}
\ No newline at end of file
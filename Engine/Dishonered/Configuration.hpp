@@ -1,7 +1,10 @@
 #pragma once
+#include <algorithm>
 #include <map>
 #include <string>
+#include <vector>
 #include <filesystem>
+#include "../../Framework/Scanner.hpp"
 
 /*
 # ========================================================================================= #
@@ -50,6 +53,11 @@ private: // Generator Settings
 	static uint32_t m_finalAlignment;
 	static std::vector<std::string> m_blacklistedTypes;
 	static std::map<std::string, std::string> m_typeOverrides;
+	static uint32_t m_threadCount;
+	static bool m_captureSnapshot;
+	static uint32_t m_unityFileCount;
+	static bool m_amalgamateHeaders;
+	static uint32_t m_functionChunkSize;
 
 public:
 	static bool UsingWindows();
@@ -64,12 +72,18 @@ public:
 	static bool IsTypeBlacklisted(const std::string& name);
 	static bool IsTypeOveridden(const std::string& name);
 	static std::string GetTypeOverride(const std::string& name);
+	static uint32_t GetThreadCount();
+	static bool CapturingSnapshot();
+	static uint32_t GetUnityFileCount();
+	static bool AmalgamatingHeaders();
+	static uint32_t GetFunctionChunkSize();
 
 private: // Process Event
 	static bool m_useIndex;
 	static int32_t m_peIndex;
 	static std::string m_peMask;
 	static std::pair<uint8_t*, std::string> m_pePattern;
+	static Scanner::FSignature m_peSignature;
 
 public:
 	static bool UsingProcessEventIndex();
@@ -77,15 +91,18 @@ public:
 	static uint8_t* GetProcessEventPattern();
 	static const std::string& GetProcessEventStr();
 	static const std::string& GetProcessEventMask();
+	static const Scanner::FSignature& GetProcessEventSignature();
 
 private: // Global Objects & Names
 	static bool m_useOffsets;
 	static uintptr_t m_gobjectOffset;
 	static std::string m_gobjectMask;
 	static std::pair<uint8_t*, std::string> m_gobjectPattern;
+	static Scanner::FSignature m_gobjectSignature;
 	static uintptr_t m_gnameOffset;
 	static std::string m_gnameMask;
 	static std::pair<uint8_t*, std::string> m_gnamePattern;
+	static Scanner::FSignature m_gnameSignature;
 
 public:
 	static bool UsingOffsets();
@@ -93,10 +110,12 @@ public:
 	static uint8_t* GetGObjectPattern();
 	static const std::string& GetGObjectStr();
 	static const std::string& GetGObjectMask();
+	static const Scanner::FSignature& GetGObjectSignature();
 	static uintptr_t GetGNameOffset();
 	static uint8_t* GetGNamePattern();
 	static const std::string& GetGNameStr();
 	static const std::string& GetGNameMask();
+	static const Scanner::FSignature& GetGNameSignature();
 
 private: // Game Info
 	static std::string m_gameNameLong;
@@ -110,6 +129,7 @@ public:
 	static const std::string& GetGameVersion();
 	static const std::filesystem::path& GetOutputPath();
 	static bool HasOutputPath();
+	static void SetOutputPath(const std::filesystem::path& outputPath); // Used by the offline driver, which gets its output path from the command line.
 
 public:
 	GConfig() = delete;
@@ -90,6 +90,21 @@ std::map<std::string, std::string> GConfig::m_typeOverrides = {
     { "FExampleStruct", PiecesOfTypes::Example_Struct }
 };
 
+// Number of threads used to scan GObjects when caching and to generate packages, zero uses one per hardware thread and one disables multi threading completely.
+uint32_t GConfig::m_threadCount = 0;
+
+// If set to true the generator will only capture a snapshot of GObjects and GNames in game instead of generating, an sdk can then be generated from it later without the game running.
+bool GConfig::m_captureSnapshot = false;
+
+// Number of unity translation units to generate, each one includes a group of "_classes.cpp" files so the sdk can be built from just these instead, zero doesn't generate any.
+uint32_t GConfig::m_unityFileCount = 0;
+
+// If set to true "SdkHeaders.hpp" will have every package header pasted into it instead of including them, along with a "SdkPch.hpp" and "SdkPch.cpp" precompiled header stub.
+bool GConfig::m_amalgamateHeaders = false;
+
+// Packages with more function code than this (in bytes) get split into "_classes_01.cpp", "_classes_02.cpp" and so on so they can be compiled in parallel, zero always generates a single "_classes.cpp".
+uint32_t GConfig::m_functionChunkSize = 0;
+
 bool GConfig::UsingWindows()
 {
     return m_useWindows;
@@ -165,6 +180,31 @@ std::string GConfig::GetTypeOverride(const std::string& name)
     return "";
 }
 
+uint32_t GConfig::GetThreadCount()
+{
+    return m_threadCount;
+}
+
+bool GConfig::CapturingSnapshot()
+{
+    return m_captureSnapshot;
+}
+
+uint32_t GConfig::GetUnityFileCount()
+{
+    return m_unityFileCount;
+}
+
+bool GConfig::AmalgamatingHeaders()
+{
+    return m_amalgamateHeaders;
+}
+
+uint32_t GConfig::GetFunctionChunkSize()
+{
+    return m_functionChunkSize;
+}
+
 /*
 # ========================================================================================= #
 # Process Event
@@ -183,6 +223,10 @@ std::string GConfig::m_peMask = "xxx???x";
 // First value is the actual hex escaped pattern, second value is the string version of it printed in the final sdk.
 std::pair<uint8_t*, std::string> GConfig::m_pePattern = { (uint8_t*)"\x10\x11\x12\x00\x00\x00\x13", "\\x10\\x11\\x12\\x00\\x00\\x00\\x13" };
 
+// IDA style signature, used instead of "m_peMask" and "m_pePattern" if it isn't empty, question marks are wildcards.
+// Resolve steps run in order from where it was found, for example "{ Scanner::Add(1), Scanner::Rip() }" follows a call instruction to the function it calls.
+Scanner::FSignature GConfig::m_peSignature = Scanner::FSignature("");
+
 bool GConfig::UsingProcessEventIndex()
 {
     return (m_useIndex && (m_peIndex != -1));
@@ -208,6 +252,11 @@ const std::string& GConfig::GetProcessEventStr()
     return m_pePattern.second;
 }
 
+const Scanner::FSignature& GConfig::GetProcessEventSignature()
+{
+    return m_peSignature;
+}
+
 /*
 # ========================================================================================= #
 # Global Objects & Names
@@ -225,6 +274,10 @@ std::string GConfig::m_gobjectMask = "xxx???x";
 // First value is the actual hex escaped pattern, second value is the string version of it printed in the final sdk.
 std::pair<uint8_t*, std::string> GConfig::m_gobjectPattern = { (uint8_t*)"\x10\x11\x12\x00\x00\x00\x13", "\\x10\\x11\\x12\\x00\\x00\\x00\\x13" };
 
+// IDA style signature, used instead of "m_gobjectMask" and "m_gobjectPattern" if it isn't empty, question marks are wildcards.
+// Resolve steps run in order from where it was found, for example "48 8B 05 ? ? ? ? 48 8B 0C C8" with "{ Scanner::Add(3), Scanner::Rip() }" gets to what the mov instruction reads from.
+Scanner::FSignature GConfig::m_gobjectSignature = Scanner::FSignature("");
+
 uintptr_t GConfig::m_gnameOffset = 0x0;
 
 // Half byte mask, use question marks for unknown data.
@@ -233,6 +286,9 @@ std::string GConfig::m_gnameMask = "xxx???x";
 // First value is the actual hex escaped pattern, second value is the string version of it printed in the final sdk.
 std::pair<uint8_t*, std::string> GConfig::m_gnamePattern = { (uint8_t*)"\x10\x11\x12\x00\x00\x00\x13", "\\x10\\x11\\x12\\x00\\x00\\x00\\x13" };
 
+// Same as "m_gobjectSignature", but for global names.
+Scanner::FSignature GConfig::m_gnameSignature = Scanner::FSignature("");
+
 bool GConfig::UsingOffsets()
 {
     return m_useOffsets;
@@ -258,6 +314,11 @@ const std::string& GConfig::GetGObjectMask()
     return m_gobjectMask;
 }
 
+const Scanner::FSignature& GConfig::GetGObjectSignature()
+{
+    return m_gobjectSignature;
+}
+
 uintptr_t GConfig::GetGNameOffset()
 {
     return m_gnameOffset;
@@ -278,6 +339,11 @@ const std::string& GConfig::GetGNameMask()
     return m_gnameMask;
 }
 
+const Scanner::FSignature& GConfig::GetGNameSignature()
+{
+    return m_gnameSignature;
+}
+
 /*
 # ========================================================================================= #
 # Game Info
@@ -321,6 +387,11 @@ bool GConfig::HasOutputPath()
     return (!GetOutputPath().string().empty() && (GetOutputPath().string() != "I_FORGOT_TO_SET_A_PATH"));
 }
 
+void GConfig::SetOutputPath(const std::filesystem::path& outputPath)
+{
+    m_outputPath = outputPath;
+}
+
 /*
 # ========================================================================================= #
 #
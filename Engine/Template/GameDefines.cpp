@@ -22,7 +22,7 @@ class TArray<class UObject*>* UObject::GObjObjects()
 
 std::string UObject::GetName()
 {
-	return this->Name.ToString();
+	return std::string(this->Name.ToStringView());
 }
 
 std::string UObject::GetNameCPP()
@@ -35,7 +35,7 @@ std::string UObject::GetNameCPP()
 
 		while (uClass)
 		{
-			std::string className = uClass->GetName();
+			std::string_view className = uClass->Name.ToStringView();
 
 			if (className == "Actor")
 			{
@@ -62,14 +62,24 @@ std::string UObject::GetNameCPP()
 
 std::string UObject::GetFullName()
 {
-	std::string fullName = this->GetName();
+	std::vector<UObject*> outers;
 
 	for (UObject* uOuter = this->Outer; uOuter; uOuter = uOuter->Outer)
 	{
-		fullName = (uOuter->GetName() + "." + fullName);
+		outers.push_back(uOuter);
 	}
 
-	fullName = (this->Class->GetName() + " " + fullName);
+	// Appending from the outermost object in instead of prepending each outer, which copied the whole string every time.
+	std::string fullName(this->Class->Name.ToStringView());
+	fullName += " ";
+
+	for (auto outerIt = outers.rbegin(); outerIt != outers.rend(); outerIt++)
+	{
+		fullName += (*outerIt)->Name.ToStringView();
+		fullName += ".";
+	}
+
+	fullName += this->Name.ToStringView();
 	return fullName;
 }
 
@@ -1,14 +1,18 @@
 #pragma once
 #include <algorithm>
 #include <stdlib.h>
+#include <string.h>
 #include <locale.h>
+#ifdef _WIN32
 #include <xlocale>
+#endif
 #include <ctype.h>
 #include <chrono>
 #include <thread>
 #include <vector>
 #include <map>
 #include <functional>
+#include <string_view>
 #include "Configuration.hpp"
 #include "../../Framework/Member.hpp"
 
@@ -541,6 +545,14 @@ private:
 	}
 };
 
+// Defined before "TMap" because its "IndirectData" member needs the complete type.
+// FPointer
+// (0x0000 - 0x0004)
+struct FPointer
+{
+	uintptr_t Dummy; // 0x0000 (0x04)
+};
+
 // THIS CLASS CAN BE GAME SPECIFIC, MOST GAMES WILL GENERATE A STRUCT MIRROR!
 template<typename TKey, typename TValue>
 class TMap
@@ -783,9 +795,21 @@ public:
 
 	std::string ToString() const
 	{
-		std::wstring wstr = ToWideString();
-		std::string str(wstr.begin(), wstr.end());
-		return str;
+		return std::string(ToStringView());
+	}
+
+	// Narrowed into a buffer that's reused by every call on the same thread, so the returned view is only valid until the next call.
+	std::string_view ToStringView() const
+	{
+		thread_local std::string nameBuffer;
+		nameBuffer.clear();
+
+		for (const wchar_t* wideName = GetWideName(); *wideName; wideName++)
+		{
+			nameBuffer += static_cast<char>(*wideName);
+		}
+
+		return nameBuffer;
 	}
 #else
 	const char* GetAnsiName() const
@@ -797,6 +821,11 @@ public:
 	{
 		return std::string(Name);
 	}
+
+	std::string_view ToStringView() const
+	{
+		return std::string_view(Name);
+	}
 #endif
 };
 
@@ -926,9 +955,15 @@ public:
 
 	std::string ToString() const
 	{
-		if (IsValid())
+		return std::string(ToStringView());
+	}
+
+	// Reads straight from the name entry instead of copying it like "GetDisplayNameEntry" does.
+	std::string_view ToStringView() const
+	{
+		if (IsValid() && Names()->at(FNameEntryId))
 		{
-			return GetDisplayNameEntry().ToString();
+			return Names()->at(FNameEntryId)->ToStringView();
 		}
 
 		return "UnknownName";
@@ -1100,13 +1135,6 @@ struct FScriptDelegate
 	class FName FunctionName; // 0x0004 (0x08)
 };
 
-// FPointer
-// (0x0000 - 0x0004)
-struct FPointer
-{
-	uintptr_t Dummy; // 0x0000 (0x04)
-};
-
 // FQWord
 // (0x0000 - 0x0008)
 struct FQWord
@@ -4,50 +4,31 @@
 namespace Printer
 {
     static constexpr uint32_t MAX_FILL_LENGTH = 1024;
+    static constexpr uint32_t MAX_NUMBER_WIDTH = (NUMBER_BUFFER_LENGTH - 2); // Leaves room for the "0x" prefix of hex numbers.
 
-    void Empty(std::ostringstream& stream)
+    void Empty(TextBuffer& buffer)
     {
-        stream.str(std::string());
+        buffer.clear();
     }
 
-    void FillRight(std::ostringstream& stream, char fill, uint32_t width)
+    void FillRight(TextBuffer& buffer, char fill, uint32_t width)
     {
         if (width > MAX_FILL_LENGTH)
         {
             width = MAX_FILL_LENGTH;
         }
 
-        stream << std::setfill(fill) << std::setw(width) << std::right;
+        buffer.pad_next(width, fill, false);
     }
 
-    void FillLeft(std::ostringstream& stream, char fill, uint32_t width)
+    void FillLeft(TextBuffer& buffer, char fill, uint32_t width)
     {
         if (width > MAX_FILL_LENGTH)
         {
             width = MAX_FILL_LENGTH;
         }
 
-        stream << std::setfill(fill) << std::setw(width) << std::left;
-    }
-
-    void FillRight(std::ofstream& stream, char fill, uint32_t width)
-    {
-        if (width > MAX_FILL_LENGTH)
-        {
-            width = MAX_FILL_LENGTH;
-        }
-
-        stream << std::setfill(fill) << std::setw(width) << std::right;
-    }
-
-    void FillLeft(std::ofstream& stream, char fill, uint32_t width)
-    {
-        if (width > MAX_FILL_LENGTH)
-        {
-            width = MAX_FILL_LENGTH;
-        }
-
-        stream << std::setfill(fill) << std::setw(width) << std::left;
+        buffer.pad_next(width, fill, true);
     }
 
     void ReplaceChars(std::string& baseStr, char oldChar, char newChar)
@@ -76,11 +57,78 @@ namespace Printer
         }
     }
 
+    std::string_view Hex(NumberBuffer& buffer, uintptr_t decimal, uint32_t width)
+    {
+        // Digits are written right after the prefix, then shifted over if they need to be padded with zeros.
+        char* digits = (buffer + 2);
+        char* bufferEnd = (buffer + NUMBER_BUFFER_LENGTH);
+        std::to_chars_result result = std::to_chars(digits, bufferEnd, decimal, 16);
+        size_t length = (result.ptr - digits);
+
+        if (width > MAX_NUMBER_WIDTH)
+        {
+            width = MAX_NUMBER_WIDTH;
+        }
+
+        if (length < width)
+        {
+            std::memmove((digits + (width - length)), digits, length);
+            std::memset(digits, '0', (width - length));
+            length = width;
+        }
+
+        for (size_t i = 0; i < length; i++)
+        {
+            if (digits[i] >= 'a')
+            {
+                digits[i] -= ('a' - 'A');
+            }
+        }
+
+        buffer[0] = '0';
+        buffer[1] = 'x';
+        return std::string_view(buffer, (length + 2));
+    }
+
+    std::string_view Hex(NumberBuffer& buffer, uintptr_t decimal, EWidthTypes width)
+    {
+        return Hex(buffer, decimal, static_cast<uint32_t>(width));
+    }
+
+    std::string_view Hex(NumberBuffer& buffer, void* pointer)
+    {
+        return Hex(buffer, reinterpret_cast<uintptr_t>(pointer), sizeof(uintptr_t));
+    }
+
+    std::string_view Decimal(NumberBuffer& buffer, uintptr_t hex, uint32_t width)
+    {
+        std::to_chars_result result = std::to_chars(buffer, (buffer + NUMBER_BUFFER_LENGTH), hex);
+        size_t length = (result.ptr - buffer);
+
+        if (width > MAX_NUMBER_WIDTH)
+        {
+            width = MAX_NUMBER_WIDTH;
+        }
+
+        if (length < width)
+        {
+            std::memmove((buffer + (width - length)), buffer, length);
+            std::memset(buffer, '0', (width - length));
+            length = width;
+        }
+
+        return std::string_view(buffer, length);
+    }
+
+    std::string_view Decimal(NumberBuffer& buffer, uintptr_t hex, EWidthTypes width)
+    {
+        return Decimal(buffer, hex, static_cast<uint32_t>(width));
+    }
+
     std::string Hex(uintptr_t decimal, uint32_t width)
     {
-        std::ostringstream stream;
-        stream << "0x" << std::setfill('0') << std::setw(width) << std::right << std::uppercase << std::hex << decimal;
-        return stream.str();
+        NumberBuffer buffer;
+        return std::string(Hex(buffer, decimal, width));
     }
 
     std::string Hex(uintptr_t decimal, EWidthTypes width)
@@ -95,9 +143,8 @@ namespace Printer
 
     std::string Decimal(uintptr_t hex, uint32_t width)
     {
-        std::ostringstream stream;
-        stream << std::setfill('0') << std::setw(width) << std::right << std::uppercase << std::dec << hex;
-        return stream.str();
+        NumberBuffer buffer;
+        return std::string(Decimal(buffer, hex, width));
     }
 
     std::string Decimal(uintptr_t hex, EWidthTypes width)
@@ -132,88 +179,77 @@ namespace Printer
         return str;
     }
 
-    void Header(std::ostringstream& stream, const std::string& fileName, const std::string& fileExtension, bool bPragmaPush)
+    void Header(TextBuffer& buffer, const std::string& fileName, const std::string& fileExtension, bool bPragmaPush, const std::set<std::string>& includes)
     {
-        stream << "/*\n";
-        stream << "#############################################################################################\n";
-        stream << "# " << GConfig::GetGameNameLong() << " (" << GConfig::GetGameNameShort() + ") SDK " << GConfig::GetGameVersion() << "\n";
-        stream << "# Generated with the " << GEngine::GetName() << " " << GEngine::GetVersion() << "\n";
-        stream << "# ========================================================================================= #\n";
-        stream << "# File: " << fileName << "." << fileExtension << "\n";
-        stream << "# ========================================================================================= #\n";
-        stream << "# Credits: " << GEngine::GetCredits() << "\n";
-        stream << "# Links: " << GEngine::GetLinks() << "\n";
-        stream << "#############################################################################################\n";
-        stream << "*/\n";
+        buffer << "/*\n";
+        buffer << "#############################################################################################\n";
+        buffer << "# " << GConfig::GetGameNameLong() << " (" << GConfig::GetGameNameShort() + ") SDK " << GConfig::GetGameVersion() << "\n";
+        buffer << "# Generated with the " << GEngine::GetName() << " " << GEngine::GetVersion() << "\n";
+        buffer << "# ========================================================================================= #\n";
+        buffer << "# File: " << fileName << "." << fileExtension << "\n";
+        buffer << "# ========================================================================================= #\n";
+        buffer << "# Credits: " << GEngine::GetCredits() << "\n";
+        buffer << "# Links: " << GEngine::GetLinks() << "\n";
+        buffer << "#############################################################################################\n";
+        buffer << "*/\n";
+
+        // Files in the root of the sdk folder handle their own includes, only package files get them added here.
+        bool bRootFile = ((fileName == "SdkHeaders") || (fileName == "SdkConstants") || (fileName == "SdkPch") || (fileName.rfind("SdkUnity_", 0) == 0) || (fileName == "GameDefines"));
 
-        if ((fileName != "SdkHeaders") && (fileName != "SdkConstants") && (fileName != "GameDefines"))
+        if (!bRootFile)
         {
             if (fileExtension == "hpp")
             {
-                stream << "#pragma once\n";
+                buffer << "#pragma once\n";
+                buffer << "#include \"../GameDefines.hpp\"\n";
 
                 if (GConfig::UsingConstants())
                 {
-                    stream << "#include \"../SdkConstants.hpp\"\n";
+                    buffer << "#include \"../SdkConstants.hpp\"\n";
                 }
             }
-            else if (fileExtension == "cpp")
+            else if ((fileExtension == "cpp") && includes.empty())
             {
-                stream << "#include \"../SdkHeaders.hpp\"\n";
+                buffer << "#include \"../SdkHeaders.hpp\"\n";
+            }
+
+            for (const std::string& include : includes)
+            {
+                buffer << "#include \"" << include << "\"\n";
             }
         }
 
         if (bPragmaPush)
         {
-            stream << "\n#ifdef _MSC_VER\n";
-            stream << "#pragma pack(push, " + Hex(GConfig::GetFinalAlignment(), 1) + ")\n";
-            stream << "#endif\n";
+            buffer << "\n#ifdef _MSC_VER\n";
+            NumberBuffer numberBuffer;
+            buffer << "#pragma pack(push, " << Hex(numberBuffer, GConfig::GetFinalAlignment(), 1) << ")\n";
+            buffer << "#endif\n";
         }
     }
 
-    void Header(std::ofstream& stream, const std::string& fileName, const std::string& fileExtension, bool bPragmaPush)
-    {
-        std::ostringstream sStream;
-        Header(sStream, fileName, fileExtension, bPragmaPush);
-        stream << sStream.str();
-    }
-
-    void Section(std::ostringstream& stream, const std::string& sectionName)
-    {
-        stream << "\n/*\n";
-        stream << "# ========================================================================================= #\n";
-        stream << "# " << sectionName << "\n";
-        stream << "# ========================================================================================= #\n";
-        stream << "*/\n\n";
-    }
-
-    void Section(std::ofstream& stream, const std::string& sectionName)
+    void Section(TextBuffer& buffer, const std::string& sectionName)
     {
-        std::ostringstream sStream;
-        Section(sStream, sectionName);
-        stream << sStream.str();
+        buffer << "\n/*\n";
+        buffer << "# ========================================================================================= #\n";
+        buffer << "# " << sectionName << "\n";
+        buffer << "# ========================================================================================= #\n";
+        buffer << "*/\n\n";
     }
 
-    void Footer(std::ostringstream& stream, bool bPragmaPop)
+    void Footer(TextBuffer& buffer, bool bPragmaPop)
     {
-        stream << "/*\n";
-        stream << "# ========================================================================================= #\n";
-        stream << "#\n";
-        stream << "# ========================================================================================= #\n";
-        stream << "*/\n";
+        buffer << "/*\n";
+        buffer << "# ========================================================================================= #\n";
+        buffer << "#\n";
+        buffer << "# ========================================================================================= #\n";
+        buffer << "*/\n";
 
         if (bPragmaPop)
         {
-            stream << "\n#ifdef _MSC_VER\n";
-            stream << "#pragma pack(pop)\n";
-            stream << "#endif\n";
+            buffer << "\n#ifdef _MSC_VER\n";
+            buffer << "#pragma pack(pop)\n";
+            buffer << "#endif\n";
         }
     }
-
-    void Footer(std::ofstream& stream, bool bPragmaPop)
-    {
-        std::ostringstream sStream;
-        Footer(sStream, bPragmaPop);
-        stream << sStream.str();
-    }
 }
\ No newline at end of file
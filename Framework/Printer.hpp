@@ -2,7 +2,12 @@
 #include <sstream>
 #include <fstream>
 #include <string>
+#include <string_view>
+#include <set>
+#include <charconv>
+#include <cstring>
 #include <cstdarg>
+#include "TextBuffer.hpp"
 
 enum class EWidthTypes : uint32_t
 {
@@ -17,13 +22,21 @@ enum class EWidthTypes : uint32_t
 
 namespace Printer
 {
-	void Empty(std::ostringstream& stream);
-	void FillRight(std::ostringstream& stream, char fill, uint32_t width);
-	void FillLeft(std::ostringstream& stream, char fill, uint32_t width);
-	void FillRight(std::ofstream& stream, char fill, uint32_t width);
-	void FillLeft(std::ofstream& stream, char fill, uint32_t width);
+	// Caller supplied buffer for the hex and decimal overloads that don't allocate, big enough for any 64-bit number with its prefix and padding.
+	// The returned string view points into the buffer, so it's only valid until the same buffer is used again.
+	static constexpr uint32_t NUMBER_BUFFER_LENGTH = 32;
+	using NumberBuffer = char[NUMBER_BUFFER_LENGTH];
+
+	void Empty(TextBuffer& buffer);
+	void FillRight(TextBuffer& buffer, char fill, uint32_t width);
+	void FillLeft(TextBuffer& buffer, char fill, uint32_t width);
 	void ReplaceChars(std::string& baseStr, char oldChar, char newChar);
 	void ReplaceString(std::string& baseStr, const std::string& strToReplace, const std::string& replaceWithStr);
+	std::string_view Hex(NumberBuffer& buffer, uintptr_t decimal, uint32_t width);
+	std::string_view Hex(NumberBuffer& buffer, uintptr_t decimal, EWidthTypes width = EWidthTypes::None);
+	std::string_view Hex(NumberBuffer& buffer, void* pointer);
+	std::string_view Decimal(NumberBuffer& buffer, uintptr_t hex, uint32_t width);
+	std::string_view Decimal(NumberBuffer& buffer, uintptr_t hex, EWidthTypes width = EWidthTypes::None);
 	std::string Hex(uintptr_t decimal, uint32_t width);
 	std::string Hex(uintptr_t decimal, EWidthTypes width = EWidthTypes::None);
 	std::string Hex(void* pointer);
@@ -33,10 +46,7 @@ namespace Printer
 	std::string ToUpper(std::string str);
 	std::string ToLower(std::string str);
 
-	void Header(std::ostringstream& stream, const std::string& fileName, const std::string& fileExtension, bool bPragmaPush);
-	void Header(std::ofstream& stream, const std::string& fileName, const std::string& fileExtension, bool bPragmaPush);
-	void Section(std::ostringstream& stream, const std::string& sectionName);
-	void Section(std::ofstream& stream, const std::string& sectionName);
-	void Footer(std::ostringstream& stream, bool bPragmaPop);
-	void Footer(std::ofstream& stream, bool bPragmaPop);
+	void Header(TextBuffer& buffer, const std::string& fileName, const std::string& fileExtension, bool bPragmaPush, const std::set<std::string>& includes = std::set<std::string>());
+	void Section(TextBuffer& buffer, const std::string& sectionName);
+	void Footer(TextBuffer& buffer, bool bPragmaPop);
 }
\ No newline at end of file
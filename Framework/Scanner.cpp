@@ -0,0 +1,761 @@
+#include "Scanner.hpp"
+#include "Scheduler.hpp"
+#include <bit>
+#include <array>
+#include <cstring>
+
+#if defined(_M_X64) || defined(__x86_64__) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2)) || defined(__SSE2__)
+#define SCANNER_SSE2
+#include <emmintrin.h>
+#endif
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define SCANNER_AVX2
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+#endif
+
+// Msvc lets you use any intrinsic without changing the architecture of the whole file, gcc and clang need to be told per function.
+#if defined(__GNUC__) || defined(__clang__)
+#define SCANNER_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define SCANNER_TARGET_AVX2
+#endif
+
+namespace Scanner
+{
+    static constexpr size_t SCAN_CHUNK_SIZE = 0x200000; // Sections bigger than this are split up so each thread gets a piece.
+
+    // Same values as the "IMAGE_SCN_" defines in "winnt.h", which isn't available when not on windows.
+    static constexpr uint32_t SECTION_CODE = 0x00000020;
+    static constexpr uint32_t SECTION_INITIALIZED_DATA = 0x00000040;
+    static constexpr uint32_t SECTION_UNINITIALIZED_DATA = 0x00000080;
+    static constexpr uint32_t SECTION_DISCARDABLE = 0x02000000;
+    static constexpr uint32_t SECTION_EXECUTE = 0x20000000;
+
+    // Bytes that show up the most in x86 code, most common first, anything not in here is considered rare.
+    static constexpr uint8_t COMMON_BYTES[] = {
+        0x00, 0xFF, 0x48, 0x8B, 0xCC, 0x89, 0x24, 0x0F, 0x44, 0x4C, 0xE8, 0x85, 0x01, 0x08, 0x10, 0x20,
+        0x40, 0x83, 0xC0, 0x74, 0x75, 0x45, 0x8D, 0x4D, 0x49, 0x41, 0x18, 0x28, 0x30, 0x38, 0x5C, 0x54,
+        0x33, 0xC3, 0xE9, 0x90, 0x02, 0x04, 0x03, 0xC7, 0x84, 0x80, 0x50, 0x60, 0x70, 0x05, 0xEB, 0xC9
+    };
+
+    struct FAnchors
+    {
+        size_t Length;      // Length of the pattern, which is the length of the mask.
+        size_t Rarest;      // Index of the rarest byte that isn't a wildcard, this is the one that's searched for.
+        size_t Second;      // Index of the next rarest byte, checked along with the rarest to cut down on false matches.
+        bool bWildcard;     // If every byte in the pattern is a wildcard, which matches right away.
+    };
+
+    static uint32_t GetByteRank(uint8_t value)
+    {
+        for (size_t i = 0; i < sizeof(COMMON_BYTES); i++)
+        {
+            if (COMMON_BYTES[i] == value)
+            {
+                return static_cast<uint32_t>(sizeof(COMMON_BYTES) - i);
+            }
+        }
+
+        return 0;
+    }
+
+    struct FPatternTable
+    {
+        std::vector<FAnchors> Anchors;                      // Same order as the patterns.
+        std::array<std::vector<size_t>, 256> Buckets;       // Rarest byte values to the index of every pattern anchored on that byte.
+        std::vector<uint8_t> Bytes;                         // Every distinct rarest byte, which are the only bytes that need to be searched for.
+        std::vector<const uint8_t*> Results;
+        size_t Remaining;                                   // Number of patterns that still haven't been found.
+    };
+
+    static bool CreateAnchors(size_t size, const uint8_t* pattern, const std::string& mask, FAnchors& anchors)
+    {
+        if (!pattern || mask.empty() || (mask.length() > size))
+        {
+            return false;
+        }
+
+        anchors.Length = mask.length();
+        anchors.Rarest = SIZE_MAX;
+        anchors.Second = SIZE_MAX;
+
+        for (size_t i = 0; i < anchors.Length; i++)
+        {
+            if (mask[i] != '?')
+            {
+                uint32_t rank = GetByteRank(pattern[i]);
+
+                if ((anchors.Rarest == SIZE_MAX) || (rank < GetByteRank(pattern[anchors.Rarest])))
+                {
+                    anchors.Second = anchors.Rarest;
+                    anchors.Rarest = i;
+                }
+                else if ((anchors.Second == SIZE_MAX) || (rank < GetByteRank(pattern[anchors.Second])))
+                {
+                    anchors.Second = i;
+                }
+            }
+        }
+
+        anchors.bWildcard = (anchors.Rarest == SIZE_MAX);
+
+        if (anchors.Second == SIZE_MAX)
+        {
+            anchors.Second = anchors.Rarest;
+        }
+
+        return true;
+    }
+
+    static bool IsMatch(const uint8_t* position, const uint8_t* pattern, const std::string& mask)
+    {
+        for (size_t i = 0; i < mask.length(); i++)
+        {
+            if ((mask[i] != '?') && (position[i] != pattern[i]))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    static void CreateTable(const uint8_t* data, size_t size, const std::vector<FPattern>& patterns, FPatternTable& table)
+    {
+        table.Anchors.resize(patterns.size());
+        table.Results.resize(patterns.size(), nullptr);
+        table.Remaining = 0;
+
+        for (size_t i = 0; i < patterns.size(); i++)
+        {
+            FAnchors& anchors = table.Anchors[i];
+
+            if (!data || !CreateAnchors(size, patterns[i].Pattern, patterns[i].Mask, anchors))
+            {
+                continue; // Can never match, so it stays null.
+            }
+
+            if (anchors.bWildcard)
+            {
+                table.Results[i] = data;
+                continue;
+            }
+
+            std::vector<size_t>& bucket = table.Buckets[patterns[i].Pattern[anchors.Rarest]];
+
+            if (bucket.empty())
+            {
+                table.Bytes.push_back(patterns[i].Pattern[anchors.Rarest]);
+            }
+
+            bucket.push_back(i);
+            table.Remaining++;
+        }
+    }
+
+    // Checks every pattern whose rarest byte is the one at "position", returns true once all patterns have been found.
+    static bool CheckCandidate(const uint8_t* data, size_t size, const std::vector<FPattern>& patterns, size_t position, FPatternTable& table)
+    {
+        for (size_t i : table.Buckets[data[position]])
+        {
+            const FAnchors& anchors = table.Anchors[i];
+
+            if (!table.Results[i]
+                && (position >= anchors.Rarest)
+                && ((position - anchors.Rarest) <= (size - anchors.Length))
+                && IsMatch((data + position - anchors.Rarest), patterns[i].Pattern, patterns[i].Mask))
+            {
+                table.Results[i] = (data + position - anchors.Rarest);
+                table.Remaining--;
+            }
+        }
+
+        return (table.Remaining == 0);
+    }
+
+    static void ScanTable(const uint8_t* data, size_t size, const std::vector<FPattern>& patterns, size_t position, FPatternTable& table)
+    {
+        for (; (position < size) && (table.Remaining > 0); position++)
+        {
+            if (!table.Buckets[data[position]].empty() && CheckCandidate(data, size, patterns, position, table))
+            {
+                break;
+            }
+        }
+    }
+
+    const uint8_t* Find(const uint8_t* data, size_t size, const uint8_t* pattern, const std::string& mask)
+    {
+        if (HasAVX2())
+        {
+            return FindAVX2(data, size, pattern, mask);
+        }
+        else if (HasSSE2())
+        {
+            return FindSSE2(data, size, pattern, mask);
+        }
+
+        return FindScalar(data, size, pattern, mask);
+    }
+
+    // Memchr is already vectorized by most runtimes, so this is only a little slower than the versions below.
+    const uint8_t* FindScalar(const uint8_t* data, size_t size, const uint8_t* pattern, const std::string& mask)
+    {
+        FAnchors anchors;
+
+        if (!data || !CreateAnchors(size, pattern, mask, anchors))
+        {
+            return nullptr;
+        }
+
+        if (anchors.bWildcard)
+        {
+            return data;
+        }
+
+        const uint8_t* searchStart = (data + anchors.Rarest);
+        const uint8_t* searchEnd = (data + (size - anchors.Length) + anchors.Rarest + 1); // One past where the rarest byte would be for the last position the pattern fits.
+
+        while (searchStart < searchEnd)
+        {
+            const uint8_t* found = static_cast<const uint8_t*>(std::memchr(searchStart, pattern[anchors.Rarest], (searchEnd - searchStart)));
+
+            if (!found)
+            {
+                break;
+            }
+
+            const uint8_t* position = (found - anchors.Rarest);
+
+            if (IsMatch(position, pattern, mask))
+            {
+                return position;
+            }
+
+            searchStart = (found + 1);
+        }
+
+        return nullptr;
+    }
+
+    const uint8_t* FindSSE2(const uint8_t* data, size_t size, const uint8_t* pattern, const std::string& mask)
+    {
+#ifdef SCANNER_SSE2
+        FAnchors anchors;
+
+        if (!data || !CreateAnchors(size, pattern, mask, anchors))
+        {
+            return nullptr;
+        }
+
+        if (anchors.bWildcard)
+        {
+            return data;
+        }
+
+        const __m128i rarestBytes = _mm_set1_epi8(static_cast<char>(pattern[anchors.Rarest]));
+        const __m128i secondBytes = _mm_set1_epi8(static_cast<char>(pattern[anchors.Second]));
+        size_t lastPosition = (size - anchors.Length);
+        size_t farthest = ((anchors.Rarest > anchors.Second) ? anchors.Rarest : anchors.Second);
+        size_t position = 0;
+
+        for (; (position <= lastPosition) && ((position + farthest + sizeof(__m128i)) <= size); position += sizeof(__m128i))
+        {
+            __m128i rarest = _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + position + anchors.Rarest)), rarestBytes);
+            __m128i second = _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + position + anchors.Second)), secondBytes);
+            uint32_t candidates = static_cast<uint32_t>(_mm_movemask_epi8(_mm_and_si128(rarest, second)));
+
+            while (candidates)
+            {
+                size_t candidate = (position + std::countr_zero(candidates));
+
+                if ((candidate <= lastPosition) && IsMatch((data + candidate), pattern, mask))
+                {
+                    return (data + candidate);
+                }
+
+                candidates &= (candidates - 1);
+            }
+        }
+
+        if (position <= lastPosition)
+        {
+            return FindScalar((data + position), (size - position), pattern, mask); // Whatever's left is too close to the end to load a full vector.
+        }
+
+        return nullptr;
+#else
+        return FindScalar(data, size, pattern, mask);
+#endif
+    }
+
+    SCANNER_TARGET_AVX2 const uint8_t* FindAVX2(const uint8_t* data, size_t size, const uint8_t* pattern, const std::string& mask)
+    {
+#ifdef SCANNER_AVX2
+        FAnchors anchors;
+
+        if (!data || !CreateAnchors(size, pattern, mask, anchors))
+        {
+            return nullptr;
+        }
+
+        if (anchors.bWildcard)
+        {
+            return data;
+        }
+
+        const __m256i rarestBytes = _mm256_set1_epi8(static_cast<char>(pattern[anchors.Rarest]));
+        const __m256i secondBytes = _mm256_set1_epi8(static_cast<char>(pattern[anchors.Second]));
+        size_t lastPosition = (size - anchors.Length);
+        size_t farthest = ((anchors.Rarest > anchors.Second) ? anchors.Rarest : anchors.Second);
+        size_t position = 0;
+
+        for (; (position <= lastPosition) && ((position + farthest + sizeof(__m256i)) <= size); position += sizeof(__m256i))
+        {
+            __m256i rarest = _mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + position + anchors.Rarest)), rarestBytes);
+            __m256i second = _mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + position + anchors.Second)), secondBytes);
+            uint32_t candidates = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_and_si256(rarest, second)));
+
+            while (candidates)
+            {
+                size_t candidate = (position + std::countr_zero(candidates));
+
+                if ((candidate <= lastPosition) && IsMatch((data + candidate), pattern, mask))
+                {
+                    return (data + candidate);
+                }
+
+                candidates &= (candidates - 1);
+            }
+        }
+
+        if (position <= lastPosition)
+        {
+            return FindSSE2((data + position), (size - position), pattern, mask);
+        }
+
+        return nullptr;
+#else
+        return FindSSE2(data, size, pattern, mask);
+#endif
+    }
+
+    std::vector<const uint8_t*> FindAll(const uint8_t* data, size_t size, const std::vector<FPattern>& patterns)
+    {
+        if (HasAVX2())
+        {
+            return FindAllAVX2(data, size, patterns);
+        }
+        else if (HasSSE2())
+        {
+            return FindAllSSE2(data, size, patterns);
+        }
+
+        return FindAllScalar(data, size, patterns);
+    }
+
+    std::vector<const uint8_t*> FindAllScalar(const uint8_t* data, size_t size, const std::vector<FPattern>& patterns)
+    {
+        FPatternTable table;
+        CreateTable(data, size, patterns, table);
+        ScanTable(data, size, patterns, 0, table);
+        return table.Results;
+    }
+
+    // Unlike "FindSSE2" the position here is where a rarest byte could be, not where a pattern starts, since each pattern's rarest byte is at a different index.
+    std::vector<const uint8_t*> FindAllSSE2(const uint8_t* data, size_t size, const std::vector<FPattern>& patterns)
+    {
+        FPatternTable table;
+        CreateTable(data, size, patterns, table);
+        size_t position = 0;
+
+#ifdef SCANNER_SSE2
+        __m128i searchBytes[256]; // One for each possible byte value, only the first "table.Bytes.size()" are used.
+
+        for (size_t i = 0; i < table.Bytes.size(); i++)
+        {
+            searchBytes[i] = _mm_set1_epi8(static_cast<char>(table.Bytes[i]));
+        }
+
+        for (; (table.Remaining > 0) && ((position + sizeof(__m128i)) <= size); position += sizeof(__m128i))
+        {
+            __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + position));
+            uint32_t candidates = 0;
+
+            for (size_t i = 0; i < table.Bytes.size(); i++)
+            {
+                candidates |= static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(block, searchBytes[i])));
+            }
+
+            while (candidates)
+            {
+                if (CheckCandidate(data, size, patterns, (position + std::countr_zero(candidates)), table))
+                {
+                    return table.Results;
+                }
+
+                candidates &= (candidates - 1);
+            }
+        }
+#endif
+
+        ScanTable(data, size, patterns, position, table);
+        return table.Results;
+    }
+
+    SCANNER_TARGET_AVX2 std::vector<const uint8_t*> FindAllAVX2(const uint8_t* data, size_t size, const std::vector<FPattern>& patterns)
+    {
+#ifdef SCANNER_AVX2
+        FPatternTable table;
+        CreateTable(data, size, patterns, table);
+        __m256i searchBytes[256]; // One for each possible byte value, only the first "table.Bytes.size()" are used.
+        size_t position = 0;
+
+        for (size_t i = 0; i < table.Bytes.size(); i++)
+        {
+            searchBytes[i] = _mm256_set1_epi8(static_cast<char>(table.Bytes[i]));
+        }
+
+        for (; (table.Remaining > 0) && ((position + sizeof(__m256i)) <= size); position += sizeof(__m256i))
+        {
+            __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + position));
+            uint32_t candidates = 0;
+
+            for (size_t i = 0; i < table.Bytes.size(); i++)
+            {
+                candidates |= static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(block, searchBytes[i])));
+            }
+
+            while (candidates)
+            {
+                if (CheckCandidate(data, size, patterns, (position + std::countr_zero(candidates)), table))
+                {
+                    return table.Results;
+                }
+
+                candidates &= (candidates - 1);
+            }
+        }
+
+        ScanTable(data, size, patterns, position, table);
+        return table.Results;
+#else
+        return FindAllSSE2(data, size, patterns);
+#endif
+    }
+
+    bool FSection::IsType(ESectionType sectionType) const
+    {
+        bool bCode = (Characteristics & (SECTION_CODE | SECTION_EXECUTE));
+
+        if (sectionType == ESectionType::Code)
+        {
+            return bCode;
+        }
+        else if (sectionType == ESectionType::Data)
+        {
+            return (!bCode && (Characteristics & (SECTION_INITIALIZED_DATA | SECTION_UNINITIALIZED_DATA)) && !(Characteristics & SECTION_DISCARDABLE));
+        }
+
+        return true;
+    }
+
+    template <typename T> static bool ReadValue(const uint8_t* image, size_t size, size_t offset, T& value)
+    {
+        if ((offset > size) || ((size - offset) < sizeof(T)))
+        {
+            return false;
+        }
+
+        std::memcpy(&value, (image + offset), sizeof(T)); // Headers aren't guaranteed to be aligned in a raw buffer.
+        return true;
+    }
+
+    bool GetSections(const uint8_t* image, size_t size, bool bMapped, std::vector<FSection>& sections)
+    {
+        sections.clear();
+
+        uint16_t dosMagic = 0;
+        uint32_t peOffset = 0;
+        uint32_t peMagic = 0;
+        uint16_t sectionCount = 0;
+        uint16_t optionalHeaderSize = 0;
+
+        if (!image
+            || !ReadValue(image, size, 0x0, dosMagic) || (dosMagic != 0x5A4D) // "MZ"
+            || !ReadValue(image, size, 0x3C, peOffset)
+            || !ReadValue(image, size, peOffset, peMagic) || (peMagic != 0x00004550) // "PE\0\0"
+            || !ReadValue(image, size, (peOffset + 0x6), sectionCount)
+            || !ReadValue(image, size, (peOffset + 0x14), optionalHeaderSize))
+        {
+            return false;
+        }
+
+        size_t sectionTable = (static_cast<size_t>(peOffset) + 0x18 + optionalHeaderSize); // Past the signature, file header, and optional header.
+
+        for (uint16_t i = 0; i < sectionCount; i++)
+        {
+            size_t sectionHeader = (sectionTable + (i * 0x28));
+            uint32_t virtualSize = 0;
+            uint32_t virtualAddress = 0;
+            uint32_t rawSize = 0;
+            uint32_t rawAddress = 0;
+            uint32_t characteristics = 0;
+
+            if (!ReadValue(image, size, (sectionHeader + 0x8), virtualSize)
+                || !ReadValue(image, size, (sectionHeader + 0xC), virtualAddress)
+                || !ReadValue(image, size, (sectionHeader + 0x10), rawSize)
+                || !ReadValue(image, size, (sectionHeader + 0x14), rawAddress)
+                || !ReadValue(image, size, (sectionHeader + 0x24), characteristics))
+            {
+                break;
+            }
+
+            FSection section;
+            section.Name.assign(reinterpret_cast<const char*>(image + sectionHeader), 8);
+            section.Name.resize(std::strlen(section.Name.c_str())); // Names are only null terminated if they're shorter than eight characters.
+            section.Offset = (bMapped ? virtualAddress : rawAddress);
+            section.Size = ((bMapped && virtualSize) ? virtualSize : rawSize);
+            section.Characteristics = characteristics;
+
+            if (section.Offset < size)
+            {
+                if (section.Size > (size - section.Offset))
+                {
+                    section.Size = (size - section.Offset);
+                }
+
+                if (section.Size > 0)
+                {
+                    sections.push_back(section);
+                }
+            }
+        }
+
+        return !sections.empty();
+    }
+
+    std::vector<const uint8_t*> FindInImage(const uint8_t* image, size_t size, bool bMapped, const std::vector<FPattern>& patterns)
+    {
+        struct FChunk
+        {
+            size_t Offset;
+            size_t Size;
+            size_t Group;
+        };
+
+        std::vector<const uint8_t*> results(patterns.size(), nullptr);
+
+        if (!image || patterns.empty())
+        {
+            return results;
+        }
+
+        std::vector<FSection> sections;
+        bool bHasSections = GetSections(image, size, bMapped, sections);
+        std::array<std::vector<FPattern>, 3> groupPatterns; // Indexed by section type, each group is found in one pass over its sections.
+        std::array<std::vector<size_t>, 3> groupIndexes;
+        std::array<size_t, 3> groupOverlap = { 0, 0, 0 };
+        std::vector<FChunk> chunks;
+
+        for (size_t i = 0; i < patterns.size(); i++)
+        {
+            size_t group = static_cast<size_t>(patterns[i].Section);
+            groupPatterns[group].push_back(patterns[i]);
+            groupIndexes[group].push_back(i);
+
+            if (patterns[i].Mask.length() > (groupOverlap[group] + 1))
+            {
+                groupOverlap[group] = (patterns[i].Mask.length() - 1); // Chunks overlap by this much so a match that crosses into the next chunk isn't missed.
+            }
+        }
+
+        for (size_t group = 0; group < groupPatterns.size(); group++)
+        {
+            if (groupPatterns[group].empty())
+            {
+                continue;
+            }
+
+            std::vector<FSection> regions;
+
+            if (bHasSections && (group != static_cast<size_t>(ESectionType::Any)))
+            {
+                for (const FSection& section : sections)
+                {
+                    if (section.IsType(static_cast<ESectionType>(group)))
+                    {
+                        regions.push_back(section);
+                    }
+                }
+            }
+            else
+            {
+                regions.push_back({ "", 0, size, 0 });
+            }
+
+            for (const FSection& region : regions)
+            {
+                for (size_t offset = 0; offset < region.Size; offset += SCAN_CHUNK_SIZE)
+                {
+                    size_t chunkSize = (region.Size - offset);
+
+                    if (chunkSize > (SCAN_CHUNK_SIZE + groupOverlap[group]))
+                    {
+                        chunkSize = (SCAN_CHUNK_SIZE + groupOverlap[group]);
+                    }
+
+                    chunks.push_back({ (region.Offset + offset), chunkSize, group });
+                }
+            }
+        }
+
+        std::vector<std::vector<const uint8_t*>> chunkResults(chunks.size());
+
+        GScheduler::ParallelFor(chunks.size(), [&](size_t chunkIndex)
+        {
+            const FChunk& chunk = chunks[chunkIndex];
+            chunkResults[chunkIndex] = FindAll((image + chunk.Offset), chunk.Size, groupPatterns[chunk.Group]);
+        });
+
+        // Lowest address wins, which is the same match a single pass from the start of the image would have found.
+        for (size_t chunkIndex = 0; chunkIndex < chunks.size(); chunkIndex++)
+        {
+            const std::vector<size_t>& indexes = groupIndexes[chunks[chunkIndex].Group];
+
+            for (size_t i = 0; i < indexes.size(); i++)
+            {
+                const uint8_t* found = chunkResults[chunkIndex][i];
+
+                if (found && (!results[indexes[i]] || (found < results[indexes[i]])))
+                {
+                    results[indexes[i]] = found;
+                }
+            }
+        }
+
+        return results;
+    }
+
+    bool FSignature::IsEmpty() const
+    {
+        return (Length == 0);
+    }
+
+    FPattern FSignature::ToPattern(ESectionType section) const
+    {
+        return { Bytes, std::string(Mask, Length), section };
+    }
+
+    uintptr_t Resolve(const uint8_t* image, size_t size, uintptr_t address, const FSignature& signature)
+    {
+        uintptr_t imageStart = reinterpret_cast<uintptr_t>(image);
+
+        for (size_t i = 0; (i < signature.StepCount) && address; i++)
+        {
+            const FResolveStep& step = signature.Steps[i];
+
+            if (step.Type == EResolveType::Add)
+            {
+                address += static_cast<intptr_t>(step.Value);
+            }
+            else if ((address < imageStart) || ((address - imageStart) > size))
+            {
+                return 0; // Only memory inside the image is read, anything else could be unmapped.
+            }
+            else if (step.Type == EResolveType::Rip)
+            {
+                int32_t displacement = 0;
+
+                if (!ReadValue(image, size, (address - imageStart), displacement))
+                {
+                    return 0;
+                }
+
+                address += (static_cast<intptr_t>(step.Value) + displacement);
+            }
+            else if (step.Type == EResolveType::Deref)
+            {
+                uintptr_t pointer = 0;
+
+                if (!ReadValue(image, size, (address - imageStart), pointer))
+                {
+                    return 0;
+                }
+
+                address = pointer;
+            }
+        }
+
+        return address;
+    }
+
+    bool Matches(const uint8_t* data, size_t size, size_t offset, const FPattern& pattern)
+    {
+        if (!data || !pattern.Pattern || pattern.Mask.empty() || (offset > size) || ((size - offset) < pattern.Mask.length()))
+        {
+            return false;
+        }
+
+        return IsMatch((data + offset), pattern.Pattern, pattern.Mask);
+    }
+
+    bool GetModuleKey(const uint8_t* image, size_t size, FModuleKey& moduleKey)
+    {
+        uint16_t dosMagic = 0;
+        uint32_t peOffset = 0;
+        uint32_t peMagic = 0;
+
+        // Everything read here is in the same place in the optional header for both 32 and 64 bit images.
+        return (image
+            && ReadValue(image, size, 0x0, dosMagic) && (dosMagic == 0x5A4D) // "MZ"
+            && ReadValue(image, size, 0x3C, peOffset)
+            && ReadValue(image, size, peOffset, peMagic) && (peMagic == 0x00004550) // "PE\0\0"
+            && ReadValue(image, size, (static_cast<size_t>(peOffset) + 0x8), moduleKey.TimeDateStamp)
+            && ReadValue(image, size, (static_cast<size_t>(peOffset) + 0x50), moduleKey.SizeOfImage)
+            && ReadValue(image, size, (static_cast<size_t>(peOffset) + 0x58), moduleKey.CheckSum));
+    }
+
+    bool HasSSE2()
+    {
+#ifdef SCANNER_SSE2
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    // Checked once, avx2 also needs the os to save the upper halves of the registers on a context switch.
+    bool HasAVX2()
+    {
+#ifdef SCANNER_AVX2
+#ifdef _MSC_VER
+        static const bool bSupported = []()
+        {
+            int32_t cpuInfo[4] = { 0 };
+            __cpuid(cpuInfo, 0);
+
+            if (cpuInfo[0] < 7)
+            {
+                return false;
+            }
+
+            __cpuid(cpuInfo, 1);
+            bool bOsSaves = ((cpuInfo[2] & (1 << 27)) && (cpuInfo[2] & (1 << 28)) && ((_xgetbv(0) & 0x6) == 0x6));
+
+            __cpuidex(cpuInfo, 7, 0);
+            return (bOsSaves && (cpuInfo[1] & (1 << 5)));
+        }();
+#else
+        static const bool bSupported = __builtin_cpu_supports("avx2");
+#endif
+        return bSupported;
+#else
+        return false;
+#endif
+    }
+}
\ No newline at end of file
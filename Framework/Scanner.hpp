@@ -0,0 +1,171 @@
+#pragma once
+#include <string>
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+#include <initializer_list>
+
+/*
+# ========================================================================================= #
+# Scanner
+# ========================================================================================= #
+*/
+
+// Finds byte patterns in a block of memory, where a '?' in the mask is a wildcard and anything else has to match the pattern exactly.
+// Instead of comparing every byte of the pattern at every position, only the rarest byte of the pattern is searched for, along with a second byte to weed out most false matches.
+// Sixteen (SSE2) or thirty two (AVX2) positions are checked at once, AVX2 is only used if both the cpu and os support it, and there's a plain loop for everything else.
+// Several patterns can also be found in a single pass, each is sorted into a table by its rarest byte so a candidate only gets compared against the patterns that could start there.
+// Module images are scanned by section, code patterns only look in executable sections and data patterns only in sections that hold data, with large sections split up between threads.
+// Everything here works on plain byte buffers, so a pe file read off disk can be scanned the same way as a module loaded in memory.
+// A module key tells builds of the same executable apart by its pe headers, so anything found in one can be cached and reused until the executable changes.
+// Signatures can also be written like "48 8B 05 ? ? ? ? 48 8B 0C C8" and are parsed at compile time, along with steps to follow from the match to whatever it references.
+
+namespace Scanner
+{
+	enum class ESectionType : uint8_t
+	{
+		Any,    // Scans the whole image, headers and padding included.
+		Code,   // Only sections that are executable.
+		Data    // Only sections that hold initialized or uninitialized data, and aren't executable.
+	};
+
+	struct FPattern
+	{
+		const uint8_t* Pattern;
+		std::string Mask;
+		ESectionType Section = ESectionType::Any;
+	};
+
+	enum class EResolveType : uint8_t
+	{
+		Add,    // Adds "Value" to the address.
+		Rip,    // Reads the rel32 displacement at the address, which is relative to "Value" bytes past it (where the next instruction starts).
+		Deref   // Reads the pointer at the address.
+	};
+
+	struct FResolveStep
+	{
+		EResolveType Type = EResolveType::Add;
+		int32_t Value = 0;
+	};
+
+	constexpr FResolveStep Add(int32_t offset) { return { EResolveType::Add, offset }; }
+	constexpr FResolveStep Rip(int32_t nextInstruction = 4) { return { EResolveType::Rip, nextInstruction }; }
+	constexpr FResolveStep Deref() { return { EResolveType::Deref, 0 }; }
+
+	void InvalidSignature(); // Never defined, it only gets called while parsing a bad signature at compile time, which turns the mistake into a compile error.
+
+	struct FSignature
+	{
+		static constexpr size_t MAX_BYTES = 128;
+		static constexpr size_t MAX_STEPS = 8;
+
+		const char* Text;
+		uint8_t Bytes[MAX_BYTES];
+		char Mask[MAX_BYTES];               // Same format as a pattern mask, but not null terminated.
+		size_t Length;
+		FResolveStep Steps[MAX_STEPS];
+		size_t StepCount;
+
+		// Bytes are two hex digits separated by spaces, and either "?" or "??" is a wildcard.
+		consteval FSignature(const char* text, std::initializer_list<FResolveStep> steps = {}) : Text(text), Bytes(), Mask(), Length(0), Steps(), StepCount(0)
+		{
+			for (size_t i = 0; text[i] != '\0';)
+			{
+				if (text[i] == ' ')
+				{
+					i++;
+					continue;
+				}
+				else if (Length >= MAX_BYTES)
+				{
+					InvalidSignature();
+				}
+				else if (text[i] == '?')
+				{
+					Bytes[Length] = 0;
+					Mask[Length++] = '?';
+					i += ((text[i + 1] == '?') ? 2 : 1);
+				}
+				else
+				{
+					Bytes[Length] = static_cast<uint8_t>((ParseDigit(text[i]) << 4) | ParseDigit(text[i + 1]));
+					Mask[Length++] = 'x';
+					i += 2;
+				}
+
+				if ((text[i] != ' ') && (text[i] != '\0'))
+				{
+					InvalidSignature(); // Every byte has to be exactly two digits, or a wildcard.
+				}
+			}
+
+			for (const FResolveStep& step : steps)
+			{
+				if (StepCount >= MAX_STEPS)
+				{
+					InvalidSignature();
+				}
+
+				Steps[StepCount++] = step;
+			}
+		}
+
+		static consteval uint8_t ParseDigit(char c)
+		{
+			if ((c >= '0') && (c <= '9'))
+			{
+				return static_cast<uint8_t>(c - '0');
+			}
+			else if ((c >= 'A') && (c <= 'F'))
+			{
+				return static_cast<uint8_t>(c - 'A' + 10);
+			}
+			else if ((c >= 'a') && (c <= 'f'))
+			{
+				return static_cast<uint8_t>(c - 'a' + 10);
+			}
+
+			InvalidSignature();
+			return 0;
+		}
+
+		bool IsEmpty() const;
+		FPattern ToPattern(ESectionType section) const;
+	};
+
+	struct FModuleKey
+	{
+		uint32_t TimeDateStamp;
+		uint32_t SizeOfImage;
+		uint32_t CheckSum;
+
+		bool operator==(const FModuleKey& other) const = default;
+	};
+
+	struct FSection
+	{
+		std::string Name;
+		size_t Offset;              // Relative to the start of the image.
+		size_t Size;
+		uint32_t Characteristics;
+
+		bool IsType(ESectionType sectionType) const;
+	};
+
+	const uint8_t* Find(const uint8_t* data, size_t size, const uint8_t* pattern, const std::string& mask); // Returns null if the pattern isn't found.
+	const uint8_t* FindScalar(const uint8_t* data, size_t size, const uint8_t* pattern, const std::string& mask);
+	const uint8_t* FindSSE2(const uint8_t* data, size_t size, const uint8_t* pattern, const std::string& mask);
+	const uint8_t* FindAVX2(const uint8_t* data, size_t size, const uint8_t* pattern, const std::string& mask);
+	std::vector<const uint8_t*> FindAll(const uint8_t* data, size_t size, const std::vector<FPattern>& patterns); // First match of each pattern in the same order, null for any that aren't found.
+	std::vector<const uint8_t*> FindAllScalar(const uint8_t* data, size_t size, const std::vector<FPattern>& patterns);
+	std::vector<const uint8_t*> FindAllSSE2(const uint8_t* data, size_t size, const std::vector<FPattern>& patterns);
+	std::vector<const uint8_t*> FindAllAVX2(const uint8_t* data, size_t size, const std::vector<FPattern>& patterns);
+	bool GetSections(const uint8_t* image, size_t size, bool bMapped, std::vector<FSection>& sections); // If mapped, sections are where the loader put them instead of where they are in the file.
+	std::vector<const uint8_t*> FindInImage(const uint8_t* image, size_t size, bool bMapped, const std::vector<FPattern>& patterns); // Falls back to scanning everything if the image has no valid pe headers.
+	bool Matches(const uint8_t* data, size_t size, size_t offset, const FPattern& pattern); // If the pattern is at exactly this offset.
+	bool GetModuleKey(const uint8_t* image, size_t size, FModuleKey& moduleKey); // Only reads the pe headers, which the loader never relocates.
+	uintptr_t Resolve(const uint8_t* image, size_t size, uintptr_t address, const FSignature& signature); // Follows the signature's steps from where it was found, returns null if any read lands outside of the image.
+	bool HasSSE2();
+	bool HasAVX2();
+}
\ No newline at end of file
@@ -0,0 +1,156 @@
+#include "Scheduler.hpp"
+
+void GScheduler::Start(uint32_t threadCount)
+{
+    if (!m_running && (threadCount > 1))
+    {
+        m_running = true;
+        m_queueIndex = 0;
+
+        for (uint32_t i = 0; i < threadCount; i++)
+        {
+            m_queues.push_back(std::make_unique<FTaskQueue>());
+        }
+
+        // Queues have to all exist before any worker starts, or one could try to steal from a queue that's still being made.
+        for (uint32_t i = 1; i < threadCount; i++)
+        {
+            m_workers.emplace_back(WorkerLoop, i);
+        }
+    }
+}
+
+void GScheduler::Stop()
+{
+    if (m_running)
+    {
+        {
+            std::lock_guard<std::mutex> sleepLock(m_sleepMutex);
+            m_running = false;
+        }
+
+        m_sleepCondition.notify_all();
+
+        for (std::thread& worker : m_workers)
+        {
+            worker.join();
+        }
+
+        m_workers.clear();
+        m_queues.clear();
+        m_queued = 0;
+    }
+}
+
+bool GScheduler::IsRunning()
+{
+    return m_running;
+}
+
+void GScheduler::ParallelFor(size_t taskCount, const std::function<void(size_t)>& function)
+{
+    if (!m_running)
+    {
+        for (size_t i = 0; i < taskCount; i++)
+        {
+            function(i);
+        }
+
+        return;
+    }
+
+    FTaskGroup group;
+    group.Remaining = taskCount;
+
+    {
+        // Counted before any of the tasks can be taken, otherwise a thread that runs one straight away could bring the count below zero.
+        std::lock_guard<std::mutex> sleepLock(m_sleepMutex);
+        m_queued += taskCount;
+    }
+
+    {
+        // Pushed in reverse so this thread works through them from first to last, while anyone stealing starts from the last.
+        std::lock_guard<std::mutex> queueLock(m_queues[m_queueIndex]->Mutex);
+
+        for (size_t i = taskCount; i > 0; i--)
+        {
+            m_queues[m_queueIndex]->Tasks.push_back({ &function, (i - 1), &group });
+        }
+    }
+
+    m_sleepCondition.notify_all();
+
+    while ((group.Remaining > 0) && RunTask())
+    {
+        // Helps with our tasks, or anyone elses, for as long as there's something to take.
+    }
+
+    // The last of our tasks are being ran by other threads, this is also what makes sure none of them are still using "group" once it goes out of scope.
+    std::unique_lock<std::mutex> groupLock(group.Mutex);
+    group.Condition.wait(groupLock, [&group]() { return (group.Remaining == 0); });
+}
+
+void GScheduler::WorkerLoop(size_t queueIndex)
+{
+    m_queueIndex = queueIndex;
+
+    while (m_running)
+    {
+        if (!RunTask())
+        {
+            std::unique_lock<std::mutex> sleepLock(m_sleepMutex);
+            m_sleepCondition.wait(sleepLock, []() { return (!m_running || (m_queued > 0)); });
+        }
+    }
+}
+
+bool GScheduler::RunTask()
+{
+    FTask task{};
+    bool bFound = PopTask(m_queueIndex, false, task);
+
+    for (size_t i = 1; !bFound && (i < m_queues.size()); i++)
+    {
+        bFound = PopTask(((m_queueIndex + i) % m_queues.size()), true, task);
+    }
+
+    if (bFound)
+    {
+        m_queued--;
+        (*task.Function)(task.Index);
+
+        // Decremented under the lock, so the thread waiting on this group can't see zero and return while it's still being notified.
+        std::lock_guard<std::mutex> groupLock(task.Group->Mutex);
+
+        if (--task.Group->Remaining == 0)
+        {
+            task.Group->Condition.notify_all();
+        }
+    }
+
+    return bFound;
+}
+
+bool GScheduler::PopTask(size_t queueIndex, bool bSteal, FTask& task)
+{
+    FTaskQueue& taskQueue = *m_queues[queueIndex];
+    std::lock_guard<std::mutex> queueLock(taskQueue.Mutex);
+
+    if (!taskQueue.Tasks.empty())
+    {
+        if (bSteal)
+        {
+            task = taskQueue.Tasks.front();
+            taskQueue.Tasks.pop_front();
+        }
+        else
+        {
+            task = taskQueue.Tasks.back();
+            taskQueue.Tasks.pop_back();
+        }
+
+        return true;
+    }
+
+    return false;
+}
\ No newline at end of file
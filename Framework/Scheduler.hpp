@@ -0,0 +1,67 @@
+#pragma once
+#include <vector>
+#include <deque>
+#include <memory>
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <condition_variable>
+
+/*
+# ========================================================================================= #
+# Scheduler
+# ========================================================================================= #
+*/
+
+// Work stealing thread pool used to generate packages, and the classes inside of them, at the same time.
+// Every thread has its own queue which it takes tasks from the back of, once it runs out it steals from the front of everyone elses.
+// A thread waiting on "ParallelFor" runs tasks for as long as there are any to take and only sleeps once the last of its own are being ran elsewhere, so tasks can start their own "ParallelFor" without running out of threads.
+
+class GScheduler
+{
+private:
+	// Every "ParallelFor" call has one of these, so the thread that made the call can sleep until the last of its tasks finish.
+	struct FTaskGroup
+	{
+		std::atomic<size_t> Remaining;
+		std::mutex Mutex;
+		std::condition_variable Condition;
+	};
+
+	struct FTask
+	{
+		const std::function<void(size_t)>* Function;
+		size_t Index;
+		FTaskGroup* Group;
+	};
+
+	struct FTaskQueue
+	{
+		std::deque<FTask> Tasks;
+		std::mutex Mutex;
+	};
+
+private:
+	static inline std::vector<std::unique_ptr<FTaskQueue>> m_queues; // First queue belongs to the thread that called "Start", the rest to each worker.
+	static inline std::vector<std::thread> m_workers;
+	static inline std::atomic<bool> m_running = false;
+	static inline std::atomic<size_t> m_queued = 0;
+	static inline std::mutex m_sleepMutex;
+	static inline std::condition_variable m_sleepCondition;
+	static inline thread_local size_t m_queueIndex = 0;
+
+public:
+	static void Start(uint32_t threadCount);
+	static void Stop();
+	static bool IsRunning();
+	static void ParallelFor(size_t taskCount, const std::function<void(size_t)>& function);
+
+private:
+	static void WorkerLoop(size_t queueIndex);
+	static bool RunTask();
+	static bool PopTask(size_t queueIndex, bool bSteal, FTask& task);
+
+public:
+	GScheduler() = delete;
+};
\ No newline at end of file
@@ -0,0 +1,712 @@
+#include "Snapshot.hpp"
+#include "../dllmain.hpp"
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+namespace Snapshot
+{
+    static constexpr char SNAPSHOT_MAGIC[8] = { 'C', 'R', 'S', 'N', 'A', 'P', 'S', 'H' };
+    static constexpr char HEAP_IMAGE_MAGIC[8] = { 'C', 'R', 'H', 'E', 'A', 'P', 'I', 'M' };
+
+    static uintptr_t m_processEvent = 0;
+    static bool m_loaded = false;
+
+    // Snapshots and heap images are both mapped copy on write, relocating a pointer only changes this processes copy of the page and never the file itself.
+    // Objects in GObjects and GNames point straight into the mapping once either is loaded, so it has to stay alive for the whole generation.
+    static uint8_t* m_image = nullptr;
+    static size_t m_imageSize = 0;
+    static std::vector<HeapImageRange> m_ranges; // Sorted by address, so the range an address is in can be binary searched.
+
+    class SnapshotWriter
+    {
+    private:
+        std::vector<uint8_t> m_data;
+        std::vector<uint64_t> m_relocations;
+        std::unordered_map<uintptr_t, std::pair<uint64_t, size_t>> m_blocks; // Original address of each block to its offset and size in the data section.
+
+    public:
+        const std::vector<uint8_t>& GetData() const
+        {
+            return m_data;
+        }
+
+        const std::vector<uint64_t>& GetRelocations() const
+        {
+            return m_relocations;
+        }
+
+        uint64_t GetOffset(const void* address) const
+        {
+            auto blockIt = m_blocks.find(reinterpret_cast<uintptr_t>(address));
+
+            if (blockIt != m_blocks.end())
+            {
+                return blockIt->second.first;
+            }
+
+            return 0;
+        }
+
+        void AddBlock(const void* address, size_t size)
+        {
+            if (address && (size > 0) && !m_blocks.contains(reinterpret_cast<uintptr_t>(address)))
+            {
+                size_t offset = (((m_data.size() + SNAPSHOT_ALIGNMENT - 1) / SNAPSHOT_ALIGNMENT) * SNAPSHOT_ALIGNMENT);
+                m_data.resize(offset + size);
+                memcpy(&m_data[offset], address, size);
+                m_blocks[reinterpret_cast<uintptr_t>(address)] = { offset, size };
+            }
+        }
+
+        // Replaces the pointer at "field" in the copy of "blockAddress" with the offset of the block it points to, or null if what it points to wasn't captured.
+        void AddPointer(const void* blockAddress, const void* field)
+        {
+            auto blockIt = m_blocks.find(reinterpret_cast<uintptr_t>(blockAddress));
+
+            if (blockIt != m_blocks.end())
+            {
+                size_t fieldOffset = (reinterpret_cast<uintptr_t>(field) - reinterpret_cast<uintptr_t>(blockAddress));
+
+                if ((fieldOffset + sizeof(uintptr_t)) <= blockIt->second.second)
+                {
+                    uint64_t position = (blockIt->second.first + fieldOffset);
+                    uintptr_t& pointer = *reinterpret_cast<uintptr_t*>(&m_data[position]);
+                    auto targetIt = m_blocks.find(pointer);
+
+                    if (targetIt != m_blocks.end())
+                    {
+                        pointer = static_cast<uintptr_t>(targetIt->second.first);
+                        m_relocations.push_back(position);
+                    }
+                    else
+                    {
+                        pointer = 0;
+                    }
+                }
+            }
+        }
+    };
+
+    // Calls "visitor" with the address of every pointer the generators follow out of an object, other than "Outer" and "Class" which every object has.
+    // Shared by capturing snapshots and loading heap images, so the two can never disagree on which pointers need to be relocated.
+    template<typename T> static void ForEachPointer(UObject* uObject, uint32_t ancestry, T visitor)
+    {
+        if (ancestry & ANCESTRY_Field)
+        {
+            UField* uField = static_cast<UField*>(uObject);
+            visitor(&uField->Next);
+#ifdef SUPERFIELDS_IN_UFIELD
+            visitor(&uField->SuperField);
+#endif
+        }
+
+        if (ancestry & ANCESTRY_Struct)
+        {
+            UStruct* uStruct = static_cast<UStruct*>(uObject);
+            visitor(&uStruct->Children);
+#ifndef SUPERFIELDS_IN_UFIELD
+            visitor(&uStruct->SuperField);
+#endif
+        }
+
+        if (ancestry & ANCESTRY_Enum)
+        {
+            visitor(&static_cast<UEnum*>(uObject)->Names);
+        }
+        else if (ancestry & ANCESTRY_Const)
+        {
+            visitor(&static_cast<UConst*>(uObject)->Value);
+        }
+        else if (ancestry & ANCESTRY_StructProperty)
+        {
+            visitor(&static_cast<UStructProperty*>(uObject)->Struct);
+        }
+        else if (ancestry & ANCESTRY_ClassProperty)
+        {
+            visitor(&static_cast<UClassProperty*>(uObject)->PropertyClass);
+            visitor(&static_cast<UClassProperty*>(uObject)->MetaClass);
+        }
+        else if (ancestry & ANCESTRY_ObjectProperty)
+        {
+            visitor(&static_cast<UObjectProperty*>(uObject)->PropertyClass);
+        }
+        else if (ancestry & ANCESTRY_InterfaceProperty)
+        {
+            visitor(&static_cast<UInterfaceProperty*>(uObject)->InterfaceClass);
+        }
+        else if (ancestry & ANCESTRY_MapProperty)
+        {
+            visitor(&static_cast<UMapProperty*>(uObject)->Key);
+            visitor(&static_cast<UMapProperty*>(uObject)->Value);
+        }
+        else if (ancestry & ANCESTRY_ByteProperty)
+        {
+            visitor(&static_cast<UByteProperty*>(uObject)->Enum);
+        }
+        else if (ancestry & ANCESTRY_ArrayProperty)
+        {
+            visitor(&static_cast<UArrayProperty*>(uObject)->Inner);
+        }
+    }
+
+    static uintptr_t FindProcessEvent()
+    {
+        if (!GConfig::UsingProcessEventIndex())
+        {
+            return Generator::GetProcessEvent();
+        }
+        else if (GConfig::GetProcessEventIndex() != -1)
+        {
+            return reinterpret_cast<uintptr_t*>(UObject::StaticClass()->VfTableObject.Dummy)[GConfig::GetProcessEventIndex()];
+        }
+
+        return 0;
+    }
+
+    bool Capture(const std::filesystem::path& file)
+    {
+        if (!Generator::AreGlobalsValid())
+        {
+            Utils::MessageboxError("Error: Failed to capture a snapshot, GObjects and GNames are not valid!");
+            return false;
+        }
+
+        SnapshotWriter writer;
+        TArray<UObject*>* objects = UObject::GObjObjects();
+        TArray<FNameEntry*>* names = FName::Names();
+        int32_t objectCount = (objects->size() - 1);
+
+        writer.AddBlock(objects, sizeof(TArray<UObject*>));
+        writer.AddBlock(objects->data(), (objects->size() * sizeof(UObject*)));
+        writer.AddBlock(names, sizeof(TArray<FNameEntry*>));
+        writer.AddBlock(names->data(), (names->size() * sizeof(FNameEntry*)));
+
+        // First pass copies every block, pointers can only be replaced once everything they could point to is known.
+
+        for (int32_t i = 0; i < objectCount; i++)
+        {
+            UObject* uObject = objects->at(i);
+
+            if (uObject && uObject->Class)
+            {
+                size_t objectSize = static_cast<size_t>(uObject->Class->PropertySize); // Size of an instance of the objects class, which is the object itself.
+                writer.AddBlock(uObject, ((objectSize > sizeof(UObject)) ? objectSize : sizeof(UObject)));
+
+                uint32_t ancestry = GCache::GetAncestry(uObject->Class);
+
+                if (ancestry & ANCESTRY_Enum)
+                {
+                    UEnum* uEnum = static_cast<UEnum*>(uObject);
+                    writer.AddBlock(uEnum->Names.data(), (uEnum->Names.size() * sizeof(FName)));
+                }
+                else if (ancestry & ANCESTRY_Const)
+                {
+                    UConst* uConst = static_cast<UConst*>(uObject);
+                    writer.AddBlock(uConst->Value.c_str(), (uConst->Value.length() * sizeof(FString::ElementType)));
+                }
+            }
+        }
+
+        for (int32_t i = 0; i < names->size(); i++)
+        {
+            FNameEntry* nameEntry = names->at(i);
+
+            if (nameEntry)
+            {
+#ifdef UTF16
+                size_t nameLength = wcslen(nameEntry->Name);
+#else
+                size_t nameLength = strlen(nameEntry->Name);
+#endif
+                writer.AddBlock(nameEntry, (offsetof(FNameEntry, Name) + ((nameLength + 1) * sizeof(nameEntry->Name[0]))));
+            }
+        }
+
+        // Only the vftable of "Class Core.Object" is read by the generator, and only up to process event.
+
+        uintptr_t processEvent = FindProcessEvent();
+        UClass* objectClass = UObject::StaticClass();
+        uintptr_t* vfTable = (objectClass ? reinterpret_cast<uintptr_t*>(objectClass->VfTableObject.Dummy) : nullptr);
+
+        if (processEvent && vfTable)
+        {
+            for (uint32_t index = 0; index < 1024; index++)
+            {
+                if (vfTable[index] == processEvent)
+                {
+                    writer.AddBlock(vfTable, ((index + 1) * sizeof(uintptr_t)));
+                    writer.AddPointer(objectClass, &objectClass->VfTableObject.Dummy);
+                    break;
+                }
+            }
+        }
+
+        // "ArrayData" is the first member of both TArray and FString, which is what these pointers are relocating.
+
+        writer.AddPointer(objects, objects);
+        writer.AddPointer(names, names);
+
+        for (int32_t i = 0; i < objects->size(); i++)
+        {
+            writer.AddPointer(objects->data(), &objects->data()[i]);
+        }
+
+        for (int32_t i = 0; i < names->size(); i++)
+        {
+            writer.AddPointer(names->data(), &names->data()[i]);
+
+            if (names->at(i))
+            {
+                writer.AddPointer(names->at(i), &names->at(i)->HashNext);
+            }
+        }
+
+        for (int32_t i = 0; i < objectCount; i++)
+        {
+            UObject* uObject = objects->at(i);
+
+            if (uObject && uObject->Class)
+            {
+                uint32_t ancestry = GCache::GetAncestry(uObject->Class);
+                writer.AddPointer(uObject, &uObject->Outer);
+                writer.AddPointer(uObject, &uObject->Class);
+                ForEachPointer(uObject, ancestry, [&](void* field) { writer.AddPointer(uObject, field); });
+            }
+        }
+
+        SnapshotHeader header{};
+        memcpy(header.Magic, SNAPSHOT_MAGIC, sizeof(header.Magic));
+        header.Version = SNAPSHOT_VERSION;
+        header.PointerSize = sizeof(uintptr_t);
+        header.DataSize = writer.GetData().size();
+        header.RelocationCount = writer.GetRelocations().size();
+        header.GObjectsOffset = writer.GetOffset(objects);
+        header.GNamesOffset = writer.GetOffset(names);
+        header.ProcessEvent = processEvent;
+        header.BaseAddress = Retrievers::GetBaseAddress();
+
+        std::ofstream stream(file, std::ios::binary);
+
+        if (stream.is_open())
+        {
+            stream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+            stream.write(reinterpret_cast<const char*>(writer.GetData().data()), writer.GetData().size());
+            stream.write(reinterpret_cast<const char*>(writer.GetRelocations().data()), (writer.GetRelocations().size() * sizeof(uint64_t)));
+            stream.close();
+            return true;
+        }
+
+        Utils::MessageboxError("Error: Failed to create the snapshot file, might not have the right permissions or your directory is invalid!");
+        return false;
+    }
+
+    static bool MapFile(const std::filesystem::path& file)
+    {
+#ifdef _WIN32
+        HANDLE fileHandle = CreateFileW(file.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+
+        if (fileHandle != INVALID_HANDLE_VALUE)
+        {
+            LARGE_INTEGER fileSize;
+
+            if (GetFileSizeEx(fileHandle, &fileSize) && (fileSize.QuadPart > 0))
+            {
+                HANDLE mappingHandle = CreateFileMappingW(fileHandle, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+
+                if (mappingHandle)
+                {
+                    void* mapping = MapViewOfFile(mappingHandle, FILE_MAP_COPY, 0, 0, 0);
+
+                    if (mapping)
+                    {
+                        m_image = static_cast<uint8_t*>(mapping);
+                        m_imageSize = static_cast<size_t>(fileSize.QuadPart);
+                    }
+
+                    CloseHandle(mappingHandle); // The view keeps the mapping alive by itself.
+                }
+            }
+
+            CloseHandle(fileHandle);
+            return (m_image != nullptr);
+        }
+#else
+        int32_t descriptor = open(file.c_str(), O_RDONLY);
+
+        if (descriptor != -1)
+        {
+            struct stat fileStat;
+
+            if ((fstat(descriptor, &fileStat) == 0) && (fileStat.st_size > 0))
+            {
+                void* mapping = mmap(nullptr, static_cast<size_t>(fileStat.st_size), (PROT_READ | PROT_WRITE), MAP_PRIVATE, descriptor, 0);
+
+                if (mapping != MAP_FAILED)
+                {
+                    m_image = static_cast<uint8_t*>(mapping);
+                    m_imageSize = static_cast<size_t>(fileStat.st_size);
+                }
+            }
+
+            close(descriptor);
+            return (m_image != nullptr);
+        }
+#endif
+
+        return false;
+    }
+
+    static void UnmapFile()
+    {
+        if (m_image)
+        {
+#ifdef _WIN32
+            UnmapViewOfFile(m_image);
+#else
+            munmap(m_image, m_imageSize);
+#endif
+        }
+
+        m_image = nullptr;
+        m_imageSize = 0;
+    }
+
+    bool Load(const std::filesystem::path& file)
+    {
+        if (m_loaded)
+        {
+            Utils::MessageboxError("Error: A snapshot has already been loaded, only one can be loaded at a time!");
+            return false;
+        }
+
+        std::ifstream stream(file, std::ios::binary);
+
+        if (!stream.is_open())
+        {
+            Utils::MessageboxError("Error: Failed to open the snapshot file \"" + file.string() + "\"!");
+            return false;
+        }
+
+        SnapshotHeader header{};
+        stream.read(reinterpret_cast<char*>(&header), sizeof(header));
+
+        if (stream && (memcmp(header.Magic, HEAP_IMAGE_MAGIC, sizeof(header.Magic)) == 0))
+        {
+            stream.close();
+            return LoadHeapImage(file);
+        }
+
+        if (!stream || (memcmp(header.Magic, SNAPSHOT_MAGIC, sizeof(header.Magic)) != 0) || (header.Version != SNAPSHOT_VERSION))
+        {
+            Utils::MessageboxError("Error: Invalid snapshot file, it's either corrupted or was made with a different version of the generator!");
+            return false;
+        }
+
+        if (header.PointerSize != sizeof(uintptr_t))
+        {
+            Utils::MessageboxError("Error: Snapshot was captured from a " + std::to_string(header.PointerSize * 8) + " bit game, it can only be loaded by a generator built for the same architecture!");
+            return false;
+        }
+
+        if ((header.GObjectsOffset >= header.DataSize) || (header.GNamesOffset >= header.DataSize))
+        {
+            Utils::MessageboxError("Error: Invalid snapshot file, GObjects or GNames is out of bounds!");
+            return false;
+        }
+
+        stream.close();
+
+        if (!MapFile(file))
+        {
+            Utils::MessageboxError("Error: Failed to map the snapshot file \"" + file.string() + "\"!");
+            return false;
+        }
+
+        // Sizes are checked without adding them together, so a corrupted header can't wrap around and pass.
+        size_t remaining = ((m_imageSize > sizeof(header)) ? (m_imageSize - sizeof(header)) : 0);
+
+        if ((header.DataSize > remaining) || (header.RelocationCount > ((remaining - header.DataSize) / sizeof(uint64_t))))
+        {
+            UnmapFile();
+            Utils::MessageboxError("Error: Invalid snapshot file, it ended before all of its data could be read!");
+            return false;
+        }
+
+        // The mapping starts on a page and the header is a multiple of "SNAPSHOT_ALIGNMENT", so every block keeps the same alignment it was written with.
+        uint8_t* data = (m_image + sizeof(header));
+        const uint8_t* relocations = (data + header.DataSize);
+
+        for (uint64_t i = 0; i < header.RelocationCount; i++)
+        {
+            uint64_t position = 0;
+            memcpy(&position, (relocations + (i * sizeof(uint64_t))), sizeof(position)); // The data section isn't padded, so the relocations aren't always aligned.
+
+            if (((position + sizeof(uintptr_t)) > header.DataSize) || (*reinterpret_cast<uintptr_t*>(data + position) >= header.DataSize))
+            {
+                UnmapFile();
+                Utils::MessageboxError("Error: Invalid snapshot file, a pointer was found out of bounds!");
+                return false;
+            }
+
+            *reinterpret_cast<uintptr_t*>(data + position) += reinterpret_cast<uintptr_t>(data);
+        }
+
+        GObjects = reinterpret_cast<TArray<UObject*>*>(data + header.GObjectsOffset);
+        GNames = reinterpret_cast<TArray<FNameEntry*>*>(data + header.GNamesOffset);
+        m_processEvent = static_cast<uintptr_t>(header.ProcessEvent);
+        m_loaded = true;
+        return true;
+    }
+
+    static bool IsMapped(const void* address, size_t size)
+    {
+        uintptr_t start = reinterpret_cast<uintptr_t>(address);
+        uintptr_t imageStart = reinterpret_cast<uintptr_t>(m_image);
+        return ((start >= imageStart) && (size <= m_imageSize) && ((start - imageStart) <= (m_imageSize - size)));
+    }
+
+    // Returns where a game address ended up in the mapped heap image, or null if it wasn't dumped.
+    static uintptr_t TranslateAddress(uint64_t address)
+    {
+        auto rangeIt = std::upper_bound(m_ranges.begin(), m_ranges.end(), address, [](uint64_t value, const HeapImageRange& range) { return (value < range.Address); });
+
+        if (rangeIt != m_ranges.begin())
+        {
+            rangeIt--;
+
+            if ((address - rangeIt->Address) < rangeIt->Size)
+            {
+                return reinterpret_cast<uintptr_t>(m_image + rangeIt->FileOffset + (address - rangeIt->Address));
+            }
+        }
+
+        return 0;
+    }
+
+    // Every pointer has to be relocated exactly once, relocating an already translated pointer would look it up as a game address again.
+    static void RelocatePointer(void* field)
+    {
+        if (IsMapped(field, sizeof(uintptr_t)))
+        {
+            uintptr_t& pointer = *reinterpret_cast<uintptr_t*>(field);
+            pointer = TranslateAddress(pointer);
+        }
+    }
+
+    template<typename T> static bool RelocateArray(TArray<T>* tArray)
+    {
+        if (IsMapped(tArray, sizeof(TArray<T>)))
+        {
+            RelocatePointer(tArray); // "ArrayData" is the first member of TArray.
+            return ((tArray->size() >= 0) && IsMapped(tArray->data(), (static_cast<size_t>(tArray->size()) * sizeof(T))));
+        }
+
+        return false;
+    }
+
+    // Name entries are only dumped up to the end of their string, so instead of the whole "Name" array only the string and its terminator have to be in the image.
+    static bool IsNameMapped(const FNameEntry* nameEntry)
+    {
+        if (IsMapped(nameEntry, offsetof(FNameEntry, Name)))
+        {
+            size_t maxLength = (sizeof(nameEntry->Name) / sizeof(nameEntry->Name[0]));
+            size_t remaining = ((m_imageSize - (reinterpret_cast<const uint8_t*>(nameEntry->Name) - m_image)) / sizeof(nameEntry->Name[0]));
+
+            for (size_t i = 0; (i < maxLength) && (i < remaining); i++)
+            {
+                if (nameEntry->Name[i] == 0)
+                {
+                    return true;
+                }
+            }
+        }
+
+        return false;
+    }
+
+    // Puts everything back how it was before the heap image was mapped, so nothing is left pointing into a mapping that's about to go away.
+    static void UnloadHeapImage()
+    {
+        GObjects = nullptr;
+        GNames = nullptr;
+        m_ranges.clear();
+        UnmapFile();
+    }
+
+    bool LoadHeapImage(const std::filesystem::path& file)
+    {
+        if (m_loaded)
+        {
+            Utils::MessageboxError("Error: A snapshot has already been loaded, only one can be loaded at a time!");
+            return false;
+        }
+
+        if (!MapFile(file))
+        {
+            Utils::MessageboxError("Error: Failed to map the heap image \"" + file.string() + "\"!");
+            return false;
+        }
+
+        HeapImageHeader header{};
+
+        if (m_imageSize >= sizeof(header))
+        {
+            memcpy(&header, m_image, sizeof(header));
+        }
+
+        if ((memcmp(header.Magic, HEAP_IMAGE_MAGIC, sizeof(header.Magic)) != 0) || (header.Version != HEAP_IMAGE_VERSION))
+        {
+            UnloadHeapImage();
+            Utils::MessageboxError("Error: Invalid heap image, it's either corrupted or was made with a different version of the generator!");
+            return false;
+        }
+
+        if (header.PointerSize != sizeof(uintptr_t))
+        {
+            UnloadHeapImage();
+            Utils::MessageboxError("Error: Heap image was dumped from a " + std::to_string(header.PointerSize * 8) + " bit game, it can only be loaded by a generator built for the same architecture!");
+            return false;
+        }
+
+        if (header.RangeCount > ((m_imageSize - sizeof(header)) / sizeof(HeapImageRange)))
+        {
+            UnloadHeapImage();
+            Utils::MessageboxError("Error: Invalid heap image, it ended before all of its ranges could be read!");
+            return false;
+        }
+
+        m_ranges.resize(header.RangeCount);
+        memcpy(m_ranges.data(), (m_image + sizeof(header)), (m_ranges.size() * sizeof(HeapImageRange)));
+
+        for (const HeapImageRange& range : m_ranges)
+        {
+            if ((range.FileOffset > m_imageSize) || (range.Size > (m_imageSize - range.FileOffset)))
+            {
+                UnloadHeapImage();
+            Utils::MessageboxError("Error: Invalid heap image, a range was found out of bounds!");
+                return false;
+            }
+        }
+
+        std::sort(m_ranges.begin(), m_ranges.end(), [](const HeapImageRange& rangeA, const HeapImageRange& rangeB) { return (rangeA.Address < rangeB.Address); });
+
+        TArray<UObject*>* objects = reinterpret_cast<TArray<UObject*>*>(TranslateAddress(header.GObjects));
+        TArray<FNameEntry*>* names = reinterpret_cast<TArray<FNameEntry*>*>(TranslateAddress(header.GNames));
+
+        if (!RelocateArray(objects) || !RelocateArray(names))
+        {
+            UnloadHeapImage();
+            Utils::MessageboxError("Error: Invalid heap image, GObjects or GNames was not dumped!");
+            return false;
+        }
+
+        // Finding classes by name needs these set before the passes below can use "StaticClass" or "GCache::GetAncestry".
+        GObjects = objects;
+        GNames = names;
+
+        // Pointers are relocated in three passes, every pass only relies on what the passes before it already relocated.
+        // First is everything the arrays point to, along with "Outer" and "Class" which are all "GetFullName" needs.
+
+        for (int32_t i = 0; i < names->size(); i++)
+        {
+            RelocatePointer(&names->at(i));
+
+            if (names->at(i) && IsNameMapped(names->at(i)))
+            {
+                RelocatePointer(&names->at(i)->HashNext);
+            }
+            else
+            {
+                names->at(i) = nullptr;
+            }
+        }
+
+        UClass* metaClass = nullptr;
+
+        for (int32_t i = 0; i < objects->size(); i++)
+        {
+            RelocatePointer(&objects->at(i));
+            UObject* uObject = objects->at(i);
+
+            UClass* uClass = nullptr;
+
+            if (uObject && IsMapped(uObject, sizeof(UObject)))
+            {
+                RelocatePointer(&uObject->Outer);
+                RelocatePointer(&uObject->Class);
+                uClass = (IsMapped(uObject->Class, sizeof(UClass)) ? uObject->Class : nullptr);
+            }
+
+            // Generators read every member up to the size of an instance of the objects class, so all of that has to be in the image and not just its "UObject" part.
+            size_t objectSize = (uClass ? static_cast<size_t>(uClass->PropertySize) : 0);
+
+            if (uClass && IsMapped(uObject, ((objectSize > sizeof(UObject)) ? objectSize : sizeof(UObject))))
+            {
+                if (uClass == uObject)
+                {
+                    metaClass = uClass; // "Class Core.Class" is the only object that is an instance of itself.
+                }
+            }
+            else
+            {
+                objects->at(i) = nullptr;
+            }
+        }
+
+        if (!metaClass)
+        {
+            UnloadHeapImage();
+            Utils::MessageboxError("Error: Invalid heap image, failed to find \"Class Core.Class\" in GObjects!");
+            return false;
+        }
+
+        // Second is every class, "GCache::GetAncestry" walks their super fields so they have to be valid before it can be used on anything else.
+
+        for (int32_t i = 0; i < objects->size(); i++)
+        {
+            UObject* uObject = objects->at(i);
+
+            if (uObject && (uObject->Class == metaClass))
+            {
+                ForEachPointer(uObject, (ANCESTRY_Field | ANCESTRY_Struct | ANCESTRY_State | ANCESTRY_Class), RelocatePointer);
+            }
+        }
+
+        // Last is everything else, which is typed by its class now that ancestry works.
+
+        for (int32_t i = 0; i < objects->size(); i++)
+        {
+            UObject* uObject = objects->at(i);
+
+            if (uObject && uObject->Class && (uObject->Class != metaClass))
+            {
+                ForEachPointer(uObject, GCache::GetAncestry(uObject->Class), RelocatePointer);
+            }
+        }
+
+        // The generator only ever reads the vftable of "Class Core.Object", which only has to be in the heap image if process event is looked up by index.
+
+        if (UObject::StaticClass())
+        {
+            RelocatePointer(&UObject::StaticClass()->VfTableObject.Dummy);
+        }
+
+        m_processEvent = static_cast<uintptr_t>(header.ProcessEvent);
+        m_loaded = true;
+        return true;
+    }
+
+    bool IsLoaded()
+    {
+        return m_loaded;
+    }
+
+    uintptr_t GetProcessEvent()
+    {
+        return m_processEvent;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,68 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <filesystem>
+
+/*
+# ========================================================================================= #
+# Snapshots
+# ========================================================================================= #
+*/
+
+// A snapshot is a binary copy of everything the generators read from GObjects and GNames, so an sdk can be generated later without the game running.
+// Every object, name entry, and array is stored as a raw block exactly how it was in memory, pointers between them are stored as offsets into the data section.
+// The layout of the file is "SnapshotHeader", the data section, then an array of "uint64_t" offsets for every pointer in the data section that needs relocating.
+// Because the blocks are raw memory, a snapshot can only be loaded by a generator built with the same "GameDefines.hpp" and pointer size that captured it.
+// Loading maps the file and relocates it in place, the generators then read the mapping through GObjects and GNames exactly like they would read the game.
+// There's no separate string table or index arrays, the name entries are stored with their strings already, and the GObjects and GNames arrays are the indexes.
+
+static constexpr uint32_t SNAPSHOT_VERSION = 1;
+static constexpr size_t SNAPSHOT_ALIGNMENT = 0x8;
+
+struct SnapshotHeader
+{
+	char Magic[8];					// Always "CRSNAPSH".
+	uint32_t Version;				// Has to match "SNAPSHOT_VERSION".
+	uint32_t PointerSize;			// Has to match "sizeof(uintptr_t)".
+	uint64_t DataSize;				// Size of the data section that follows this header.
+	uint64_t RelocationCount;		// Number of offsets that follow the data section.
+	uint64_t GObjectsOffset;		// Offset of the "TArray<UObject*>" for GObjects in the data section.
+	uint64_t GNamesOffset;			// Offset of the "TArray<FNameEntry*>" for GNames in the data section.
+	uint64_t ProcessEvent;			// Address of process event in the captured game, zero if it wasn't found.
+	uint64_t BaseAddress;			// Base address of the captured game, only kept for reference.
+};
+
+static_assert(((sizeof(SnapshotHeader) % SNAPSHOT_ALIGNMENT) == 0), "The data section has to stay aligned when the file is mapped.");
+
+// A heap image is a raw dump of memory ranges from the game made by an external tool, so nothing has to be injected into the game to make one.
+// The layout of the file is "HeapImageHeader", an array of "HeapImageRange", then the bytes of every range wherever its "FileOffset" says they are.
+// Nothing in it is relocated ahead of time, the file is mapped as is and pointers are translated from game addresses to the mapping when it's loaded.
+
+static constexpr uint32_t HEAP_IMAGE_VERSION = 1;
+
+struct HeapImageHeader
+{
+	char Magic[8];					// Always "CRHEAPIM".
+	uint32_t Version;				// Has to match "HEAP_IMAGE_VERSION".
+	uint32_t PointerSize;			// Has to match "sizeof(uintptr_t)".
+	uint64_t RangeCount;			// Number of "HeapImageRange" that follow this header.
+	uint64_t GObjects;				// Address of the "TArray<UObject*>" for GObjects in the game.
+	uint64_t GNames;				// Address of the "TArray<FNameEntry*>" for GNames in the game.
+	uint64_t ProcessEvent;			// Address of process event in the game, zero if it isn't known.
+};
+
+struct HeapImageRange
+{
+	uint64_t Address;				// Address of the first byte of this range in the game.
+	uint64_t Size;					// Number of bytes dumped from the game.
+	uint64_t FileOffset;			// Where those bytes start in the heap image.
+};
+
+namespace Snapshot
+{
+	bool Capture(const std::filesystem::path& file);
+	bool Load(const std::filesystem::path& file); // Also loads heap images, the magic at the start of the file decides which it is.
+	bool LoadHeapImage(const std::filesystem::path& file);
+	bool IsLoaded();
+	uintptr_t GetProcessEvent();
+}
\ No newline at end of file
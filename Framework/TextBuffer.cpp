@@ -0,0 +1,150 @@
+#include "TextBuffer.hpp"
+
+TextBuffer::TextBuffer() : m_lineStart(0), m_padWidth(0), m_padFill(' '), m_bPadLeft(false) {}
+
+TextBuffer::~TextBuffer() {}
+
+const std::string& TextBuffer::str() const
+{
+    return m_buffer;
+}
+
+const char* TextBuffer::data() const
+{
+    return m_buffer.data();
+}
+
+size_t TextBuffer::size() const
+{
+    return m_buffer.size();
+}
+
+bool TextBuffer::empty() const
+{
+    return m_buffer.empty();
+}
+
+size_t TextBuffer::column() const
+{
+    return (m_buffer.size() - m_lineStart);
+}
+
+void TextBuffer::reserve(size_t capacity)
+{
+    m_buffer.reserve(capacity);
+}
+
+void TextBuffer::clear()
+{
+    m_buffer.clear(); // Unlike "str(std::string())" for streams, this doesn't give up the capacity we already have.
+    m_lineStart = 0;
+    m_padWidth = 0;
+}
+
+std::string TextBuffer::release()
+{
+    std::string buffer = std::move(m_buffer);
+    clear();
+    return buffer;
+}
+
+void TextBuffer::pad_next(uint32_t width, char fill, bool bLeft)
+{
+    m_padWidth = width;
+    m_padFill = fill;
+    m_bPadLeft = bLeft;
+}
+
+TextBuffer& TextBuffer::append(std::string_view str)
+{
+    size_t newLine = str.rfind('\n');
+
+    if (newLine != std::string_view::npos)
+    {
+        m_lineStart = (m_buffer.size() + newLine + 1);
+    }
+
+    m_buffer.append(str);
+    return *this;
+}
+
+TextBuffer& TextBuffer::append(size_t count, char c)
+{
+    m_buffer.append(count, c);
+
+    if ((count > 0) && (c == '\n'))
+    {
+        m_lineStart = m_buffer.size();
+    }
+
+    return *this;
+}
+
+TextBuffer& TextBuffer::pad_to_column(size_t column, char fill)
+{
+    size_t currentColumn = this->column();
+
+    if (currentColumn < column)
+    {
+        append((column - currentColumn), fill);
+    }
+
+    return *this;
+}
+
+// Padding is meant for single tokens like names and types, so left padding can just fill to the column the token started at plus the width.
+TextBuffer& TextBuffer::insert(std::string_view str)
+{
+    if (m_padWidth > str.size())
+    {
+        if (m_bPadLeft)
+        {
+            size_t startColumn = column();
+            append(str);
+            pad_to_column((startColumn + m_padWidth), m_padFill);
+        }
+        else
+        {
+            append((m_padWidth - str.size()), m_padFill);
+            append(str);
+        }
+    }
+    else
+    {
+        append(str);
+    }
+
+    m_padWidth = 0;
+    return *this;
+}
+
+TextBuffer& TextBuffer::operator<<(std::string_view str)
+{
+    return insert(str);
+}
+
+TextBuffer& TextBuffer::operator<<(const std::string& str)
+{
+    return insert(str);
+}
+
+TextBuffer& TextBuffer::operator<<(const char* str)
+{
+    return insert(str);
+}
+
+TextBuffer& TextBuffer::operator<<(const TextBuffer& buffer)
+{
+    return insert(buffer.str());
+}
+
+TextBuffer& TextBuffer::operator<<(char c)
+{
+    return insert(std::string_view(&c, 1));
+}
+
+std::ostream& operator<<(std::ostream& stream, const TextBuffer& buffer)
+{
+    stream.write(buffer.data(), buffer.size());
+    return stream;
+}
\ No newline at end of file
@@ -0,0 +1,68 @@
+#pragma once
+#include <string>
+#include <string_view>
+#include <charconv>
+#include <ostream>
+#include <type_traits>
+
+/*
+# ========================================================================================= #
+# Text Buffer
+# ========================================================================================= #
+*/
+
+// Append only text buffer the generators write into, instead of going through the locale and stream state of "std::ostringstream" for every insertion.
+// Clearing keeps the memory that was already allocated, so one buffer can be reused for every property in a struct or class without reallocating.
+// Padding set with "Printer::FillLeft" or "Printer::FillRight" works like "std::setw" does for streams, it only applies to the next "<<" insertion.
+
+class TextBuffer
+{
+private:
+	std::string m_buffer;
+	size_t m_lineStart; // Offset of the first character after the last new line, used to know what column we're at.
+	uint32_t m_padWidth;
+	char m_padFill;
+	bool m_bPadLeft;
+
+public:
+	TextBuffer();
+	~TextBuffer();
+
+public:
+	const std::string& str() const;
+	const char* data() const;
+	size_t size() const;
+	bool empty() const;
+	size_t column() const;
+	void reserve(size_t capacity);
+	void clear();
+	std::string release(); // Moves the text out of the buffer, leaving it empty.
+	void pad_next(uint32_t width, char fill, bool bLeft);
+	TextBuffer& append(std::string_view str);
+	TextBuffer& append(size_t count, char c);
+	TextBuffer& pad_to_column(size_t column, char fill = ' ');
+
+private:
+	TextBuffer& insert(std::string_view str);
+
+public:
+	TextBuffer& operator<<(std::string_view str);
+	TextBuffer& operator<<(const std::string& str);
+	TextBuffer& operator<<(const char* str);
+	TextBuffer& operator<<(const TextBuffer& buffer);
+	TextBuffer& operator<<(char c);
+	TextBuffer& operator<<(bool) = delete; // Would otherwise silently convert to a char, use "Printer::Precision" for floats.
+	TextBuffer& operator<<(float) = delete;
+	TextBuffer& operator<<(double) = delete;
+
+	// Same as streams, any integer besides chars and bools gets written as a decimal number.
+	template<typename T> requires (std::is_integral_v<T> && !std::is_same_v<T, bool> && !std::is_same_v<T, char> && !std::is_same_v<T, signed char> && !std::is_same_v<T, unsigned char>)
+	TextBuffer& operator<<(T value)
+	{
+		char digits[24];
+		std::to_chars_result result = std::to_chars(std::begin(digits), std::end(digits), value);
+		return insert(std::string_view(digits, (result.ptr - digits)));
+	}
+};
+
+std::ostream& operator<<(std::ostream& stream, const TextBuffer& buffer);
\ No newline at end of file
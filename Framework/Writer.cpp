@@ -0,0 +1,306 @@
+#include "Writer.hpp"
+#include "../dllmain.hpp"
+
+static constexpr size_t MAX_QUEUED_FILES = 32;
+
+void GWriter::Start(const std::filesystem::path& manifestFile)
+{
+    if (!m_running)
+    {
+        m_running = true;
+        m_peakDepth = 0;
+        m_bytesWritten = 0;
+        m_filesWritten = 0;
+        m_filesFailed = 0;
+        m_filesUnchanged = 0;
+        m_manifestFile = manifestFile;
+        m_changedFiles.clear();
+        LoadManifest();
+        m_thread = std::thread(WriterLoop);
+    }
+}
+
+void GWriter::Stop()
+{
+    if (m_running)
+    {
+        {
+            std::lock_guard<std::mutex> queueLock(m_queueMutex);
+            m_running = false;
+        }
+
+        m_queuedCondition.notify_all();
+        m_thread.join();
+        SaveManifest();
+        m_manifestFile.clear();
+    }
+}
+
+void GWriter::Flush()
+{
+    std::unique_lock<std::mutex> queueLock(m_queueMutex);
+    m_takenCondition.wait(queueLock, []() { return (m_queue.empty() && !m_writing); });
+}
+
+bool GWriter::IsRunning()
+{
+    std::lock_guard<std::mutex> queueLock(m_queueMutex);
+    return m_running;
+}
+
+void GWriter::Write(const std::filesystem::path& file, std::string contents)
+{
+    std::unique_lock<std::mutex> queueLock(m_queueMutex);
+
+    if (!m_running)
+    {
+        queueLock.unlock();
+        WriteFile({ file, std::move(contents) }, false);
+        return;
+    }
+
+    m_takenCondition.wait(queueLock, []() { return (m_queue.size() < MAX_QUEUED_FILES); });
+    m_queue.push_back({ file, std::move(contents) });
+
+    if (m_queue.size() > m_peakDepth)
+    {
+        m_peakDepth = m_queue.size();
+    }
+
+    queueLock.unlock();
+    m_queuedCondition.notify_one();
+}
+
+size_t GWriter::GetMaxDepth()
+{
+    return MAX_QUEUED_FILES;
+}
+
+size_t GWriter::GetPeakDepth()
+{
+    return m_peakDepth;
+}
+
+uint64_t GWriter::GetBytesWritten()
+{
+    return m_bytesWritten;
+}
+
+uint32_t GWriter::GetFilesWritten()
+{
+    return m_filesWritten;
+}
+
+uint32_t GWriter::GetFilesFailed()
+{
+    return m_filesFailed;
+}
+
+uint32_t GWriter::GetFilesUnchanged()
+{
+    return m_filesUnchanged;
+}
+
+const std::vector<std::string>& GWriter::GetChangedFiles()
+{
+    return m_changedFiles;
+}
+
+void GWriter::WriterLoop()
+{
+    while (true)
+    {
+        std::unique_lock<std::mutex> queueLock(m_queueMutex);
+        m_queuedCondition.wait(queueLock, []() { return (!m_running || !m_queue.empty()); });
+
+        if (m_queue.empty())
+        {
+            break; // Only stops once everything that was queued before "Stop" has been written.
+        }
+
+        FWriteJob job = std::move(m_queue.front());
+        m_queue.pop_front();
+        m_writing = true;
+        queueLock.unlock();
+        m_takenCondition.notify_all();
+
+        WriteFile(job, true);
+
+        queueLock.lock();
+        m_writing = false;
+        queueLock.unlock();
+        m_takenCondition.notify_all();
+    }
+}
+
+// Only the writer thread checks the manifest, so it's never touched by more than one thread at a time.
+bool GWriter::WriteFile(const FWriteJob& job, bool bCheckManifest)
+{
+    bool bUsingManifest = (bCheckManifest && !m_manifestFile.empty());
+    std::string relativeFile;
+    uint64_t hash = 0;
+
+    if (bUsingManifest)
+    {
+        relativeFile = job.File.lexically_relative(m_manifestFile.parent_path()).generic_string();
+        hash = Utils::Hash(job.Contents);
+
+        if (IsUnchanged(job, relativeFile, hash))
+        {
+            m_filesUnchanged++;
+            return true;
+        }
+    }
+
+    std::ofstream file(job.File);
+
+    if (file.is_open())
+    {
+        file.write(job.Contents.data(), job.Contents.size());
+        file.close();
+
+        if (file.good())
+        {
+            if (bUsingManifest)
+            {
+                m_manifest[relativeFile] = CreateEntry(job.File, hash);
+                m_changedFiles.push_back(relativeFile);
+            }
+
+            m_bytesWritten += job.Contents.size();
+            m_filesWritten++;
+            return true;
+        }
+    }
+
+    m_filesFailed++;
+    return false;
+}
+
+// Trusts the manifest if the file still has the size and write time it was written with, otherwise falls back to comparing against the file itself.
+bool GWriter::IsUnchanged(const FWriteJob& job, const std::string& relativeFile, uint64_t hash)
+{
+    FManifestEntry entry = CreateEntry(job.File, hash);
+
+    if (entry.WriteTime == 0)
+    {
+        return false; // Doesn't exist, or can't be read.
+    }
+
+    auto previousIt = m_previousManifest.find(relativeFile);
+
+    if ((previousIt != m_previousManifest.end()) && (previousIt->second.FileSize == entry.FileSize) && (previousIt->second.WriteTime == entry.WriteTime))
+    {
+        if (previousIt->second.Hash == hash)
+        {
+            m_manifest[relativeFile] = previousIt->second;
+            return true;
+        }
+
+        return false;
+    }
+
+    std::ifstream file(job.File); // Text mode like it was written in, so line endings read back the same as the contents.
+    std::string contents((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+    if (file.is_open() && (contents == job.Contents))
+    {
+        m_manifest[relativeFile] = entry;
+        return true;
+    }
+
+    return false;
+}
+
+// The previous manifest is only changed by "Start" and "Stop", so this is safe to call while the writer is running.
+bool GWriter::IsIntact(const std::filesystem::path& file)
+{
+    std::error_code existsError;
+
+    if (!std::filesystem::exists(file, existsError))
+    {
+        return false;
+    }
+    else if (m_manifestFile.empty())
+    {
+        return true;
+    }
+
+    auto previousIt = m_previousManifest.find(file.lexically_relative(m_manifestFile.parent_path()).generic_string());
+
+    if (previousIt != m_previousManifest.end())
+    {
+        FManifestEntry entry = CreateEntry(file, previousIt->second.Hash);
+        return ((entry.FileSize == previousIt->second.FileSize) && (entry.WriteTime == previousIt->second.WriteTime));
+    }
+
+    return false;
+}
+
+GWriter::FManifestEntry GWriter::CreateEntry(const std::filesystem::path& file, uint64_t hash)
+{
+    std::error_code sizeError;
+    std::error_code timeError;
+    FManifestEntry entry{ hash, std::filesystem::file_size(file, sizeError), 0 };
+    std::filesystem::file_time_type writeTime = std::filesystem::last_write_time(file, timeError);
+
+    if (!sizeError && !timeError)
+    {
+        entry.WriteTime = static_cast<int64_t>(writeTime.time_since_epoch().count());
+    }
+
+    return entry;
+}
+
+void GWriter::LoadManifest()
+{
+    m_previousManifest.clear();
+    m_manifest.clear();
+
+    if (!m_manifestFile.empty())
+    {
+        std::ifstream file(m_manifestFile);
+        FManifestEntry entry{};
+        std::string relativeFile;
+
+        while (file >> entry.Hash >> entry.FileSize >> entry.WriteTime)
+        {
+            file.get(); // Space between the write time and file name, the file name itself can contain spaces.
+
+            if (std::getline(file, relativeFile) && !relativeFile.empty())
+            {
+                m_previousManifest[relativeFile] = entry;
+            }
+        }
+    }
+}
+
+// Files that weren't written this run (like packages that were skipped) keep their old entry, as long as they still exist.
+void GWriter::SaveManifest()
+{
+    if (!m_manifestFile.empty())
+    {
+        TextBuffer buffer;
+
+        for (const auto& previousPair : m_previousManifest)
+        {
+            std::error_code existsError;
+
+            if (std::filesystem::exists((m_manifestFile.parent_path() / previousPair.first), existsError))
+            {
+                m_manifest.insert(previousPair);
+            }
+        }
+
+        for (const auto& manifestPair : m_manifest)
+        {
+            buffer << manifestPair.second.Hash << " " << manifestPair.second.FileSize << " " << manifestPair.second.WriteTime << " " << manifestPair.first << "\n";
+        }
+
+        std::ofstream file(m_manifestFile);
+        file << buffer;
+    }
+
+    m_previousManifest.clear();
+    m_manifest.clear();
+}
@@ -0,0 +1,85 @@
+#pragma once
+#include <string>
+#include <deque>
+#include <map>
+#include <vector>
+#include <filesystem>
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+
+/*
+# ========================================================================================= #
+# Writer
+# ========================================================================================= #
+*/
+
+// Writes finished sdk files on its own thread, so generating can keep going while the disk (or a network share) catches up.
+// Each file is handed over whole and written out in one large sequential write, instead of a stream write for every struct or class.
+// The queue is bounded so memory can't run away on slow drives, once it's full generating waits until the writer takes the next file.
+// If started with a manifest, files whose contents hash the same as last time are left untouched so their timestamps don't force a rebuild.
+// The manifest is only trusted for files that still have the size and write time they were written with, anything else is compared against the file itself.
+
+class GWriter
+{
+private:
+	struct FWriteJob
+	{
+		std::filesystem::path File;
+		std::string Contents;
+	};
+
+	struct FManifestEntry
+	{
+		uint64_t Hash; // Hash of the generated contents.
+		uintmax_t FileSize; // Size of the file on disk, which isn't the same as the contents on windows because of line endings.
+		int64_t WriteTime; // Last write time of the file on disk, so a hand edit that keeps the same size still gets caught.
+	};
+
+private:
+	static inline std::deque<FWriteJob> m_queue;
+	static inline std::mutex m_queueMutex;
+	static inline std::condition_variable m_queuedCondition; // Signaled when a file is queued, or the writer is being stopped.
+	static inline std::condition_variable m_takenCondition; // Signaled when the writer takes a file off the queue so there's room for another, and again once it's written.
+	static inline std::thread m_thread;
+	static inline bool m_running = false;
+	static inline bool m_writing = false; // If the writer has taken a file off the queue and is still writing it.
+	static inline size_t m_peakDepth = 0;
+	static inline std::atomic<uint64_t> m_bytesWritten = 0;
+	static inline std::atomic<uint32_t> m_filesWritten = 0;
+	static inline std::atomic<uint32_t> m_filesFailed = 0;
+	static inline std::atomic<uint32_t> m_filesUnchanged = 0;
+	static inline std::filesystem::path m_manifestFile;
+	static inline std::map<std::string, FManifestEntry> m_previousManifest; // Loaded from the manifest file, paths are relative to the manifest's directory.
+	static inline std::map<std::string, FManifestEntry> m_manifest; // Every file written (or left unchanged) this run, saved over the manifest file along with the previous entries for files that still exist.
+	static inline std::vector<std::string> m_changedFiles;
+
+public:
+	static void Start(const std::filesystem::path& manifestFile = std::filesystem::path());
+	static void Stop(); // Waits for every queued file to be written before returning, then saves the manifest if there is one.
+	static void Flush(); // Waits for every queued file to be written, but keeps the writer running.
+	static bool IsRunning();
+	static void Write(const std::filesystem::path& file, std::string contents); // Writes right away on the calling thread if the writer isn't running.
+	static bool IsIntact(const std::filesystem::path& file); // If the file exists, and hasn't been touched since the manifest was saved (when there is one).
+
+public:
+	static size_t GetMaxDepth();
+	static size_t GetPeakDepth();
+	static uint64_t GetBytesWritten();
+	static uint32_t GetFilesWritten();
+	static uint32_t GetFilesFailed();
+	static uint32_t GetFilesUnchanged();
+	static const std::vector<std::string>& GetChangedFiles(); // Only tracked when started with a manifest.
+
+private:
+	static void WriterLoop();
+	static bool WriteFile(const FWriteJob& job, bool bCheckManifest);
+	static bool IsUnchanged(const FWriteJob& job, const std::string& relativeFile, uint64_t hash);
+	static FManifestEntry CreateEntry(const std::filesystem::path& file, uint64_t hash);
+	static void LoadManifest();
+	static void SaveManifest();
+
+public:
+	GWriter() = delete;
+};
\ No newline at end of file
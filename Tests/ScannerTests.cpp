@@ -0,0 +1,372 @@
+#include "../Framework/Scanner.hpp"
+#include "../Framework/Scheduler.hpp"
+#include <iostream>
+#include <random>
+#include <cstring>
+#include <cstdlib>
+
+/*
+# ========================================================================================= #
+# Scanner Tests
+# ========================================================================================= #
+*/
+
+// Checks how "Scanner::FindInImage" picks which parts of a module to search, on pe images built here instead of being checked in.
+// Every image is built both the way it is on disk and the way the loader maps it, so sections start at different offsets in each.
+// Signatures are checked for how they parse, and for where their steps end up when followed from a match, including reads that fall off the end of the image.
+
+static constexpr size_t TEST_CHUNK_SIZE = 0x200000; // Has to match "SCAN_CHUNK_SIZE" in "Scanner.cpp".
+static constexpr size_t TEST_HEADER_SIZE = 0x400;
+static constexpr uint32_t TEST_PE_OFFSET = 0x80;
+static constexpr uint32_t TEST_CODE = 0x60000020; // Code, execute, read.
+static constexpr uint32_t TEST_DATA = 0xC0000040; // Initialized data, read, write.
+static constexpr uint32_t TEST_DISCARDABLE = 0x42000040; // Initialized data, discardable, read.
+
+static const uint8_t CODE_PATTERN[] = { 0x40, 0x53, 0x48, 0x83, 0xEC, 0x20, 0x8B, 0x05, 0x00, 0x00, 0x00, 0x00 };
+static const uint8_t DATA_PATTERN[] = { 0x43, 0x52, 0x44, 0x41, 0x54, 0x41, 0x7E, 0x01 };
+static const uint8_t RELOC_PATTERN[] = { 0x52, 0x45, 0x4C, 0x4F, 0x43, 0x7E, 0x02 };
+static const std::string CODE_MASK = "xxxxxxxx????";
+static const std::string DATA_MASK = "xxxxxxxx";
+static const std::string RELOC_MASK = "xxxxxxx";
+
+struct FTestSection
+{
+    std::string Name;
+    uint32_t VirtualAddress;
+    uint32_t VirtualSize;
+    uint32_t RawAddress;
+    uint32_t RawSize;
+    uint32_t Characteristics;
+
+    size_t GetOffset(bool bMapped) const
+    {
+        return (bMapped ? VirtualAddress : RawAddress);
+    }
+};
+
+static uint32_t m_checks = 0;
+static uint32_t m_failures = 0;
+
+static void Check(bool bPassed, const std::string& description)
+{
+    m_checks++;
+
+    if (!bPassed)
+    {
+        m_failures++;
+        std::cerr << "Failed: " << description << std::endl;
+    }
+}
+
+template <typename T> static void WriteValue(std::vector<uint8_t>& image, size_t offset, T value)
+{
+    std::memcpy(&image[offset], &value, sizeof(T));
+}
+
+// Only fills in what "Scanner::GetSections" reads, the dos and file headers point to the section table and the optional header is left empty.
+static std::vector<uint8_t> CreateImage(const std::vector<FTestSection>& sections, bool bMapped)
+{
+    static constexpr uint16_t OPTIONAL_HEADER_SIZE = 0xF0;
+    size_t imageSize = TEST_HEADER_SIZE;
+
+    for (const FTestSection& section : sections)
+    {
+        size_t sectionEnd = (section.GetOffset(bMapped) + (bMapped ? section.VirtualSize : section.RawSize));
+
+        if (sectionEnd > imageSize)
+        {
+            imageSize = sectionEnd;
+        }
+    }
+
+    std::vector<uint8_t> image(imageSize, 0);
+    WriteValue<uint16_t>(image, 0x0, 0x5A4D); // "MZ"
+    WriteValue<uint32_t>(image, 0x3C, TEST_PE_OFFSET);
+    WriteValue<uint32_t>(image, TEST_PE_OFFSET, 0x00004550); // "PE\0\0"
+    WriteValue<uint16_t>(image, (TEST_PE_OFFSET + 0x6), static_cast<uint16_t>(sections.size()));
+    WriteValue<uint16_t>(image, (TEST_PE_OFFSET + 0x14), OPTIONAL_HEADER_SIZE);
+
+    for (size_t i = 0; i < sections.size(); i++)
+    {
+        size_t sectionHeader = (TEST_PE_OFFSET + 0x18 + OPTIONAL_HEADER_SIZE + (i * 0x28));
+        std::memcpy(&image[sectionHeader], sections[i].Name.c_str(), sections[i].Name.length());
+        WriteValue<uint32_t>(image, (sectionHeader + 0x8), sections[i].VirtualSize);
+        WriteValue<uint32_t>(image, (sectionHeader + 0xC), sections[i].VirtualAddress);
+        WriteValue<uint32_t>(image, (sectionHeader + 0x10), sections[i].RawSize);
+        WriteValue<uint32_t>(image, (sectionHeader + 0x14), sections[i].RawAddress);
+        WriteValue<uint32_t>(image, (sectionHeader + 0x24), sections[i].Characteristics);
+    }
+
+    return image;
+}
+
+static void Plant(std::vector<uint8_t>& image, const FTestSection& section, bool bMapped, size_t offset, const uint8_t* pattern, size_t patternSize)
+{
+    std::memcpy(&image[section.GetOffset(bMapped) + offset], pattern, patternSize);
+}
+
+static void TestSections(bool bMapped)
+{
+    const std::string layout = (bMapped ? " (mapped)" : " (raw)");
+    const std::vector<FTestSection> testSections = {
+        { ".text", 0x1000, 0x800, 0x400, 0x800, TEST_CODE },
+        { ".data", 0x2000, 0x600, 0xC00, 0x400, TEST_DATA }, // Bigger in memory than on disk, like uninitialized data at the end of a section.
+        { ".reloc", 0x3000, 0x200, 0x1000, 0x200, TEST_DISCARDABLE }
+    };
+
+    std::vector<uint8_t> image = CreateImage(testSections, bMapped);
+    Plant(image, testSections[0], bMapped, 0x100, CODE_PATTERN, sizeof(CODE_PATTERN));
+    Plant(image, testSections[0], bMapped, 0x300, DATA_PATTERN, sizeof(DATA_PATTERN)); // Data patterns should skip past this one.
+    Plant(image, testSections[1], bMapped, 0x80, DATA_PATTERN, sizeof(DATA_PATTERN));
+    Plant(image, testSections[1], bMapped, 0x200, CODE_PATTERN, sizeof(CODE_PATTERN)); // Code patterns should never see this one.
+    Plant(image, testSections[2], bMapped, 0x40, RELOC_PATTERN, sizeof(RELOC_PATTERN));
+
+    std::vector<Scanner::FSection> sections;
+    Check(Scanner::GetSections(image.data(), image.size(), bMapped, sections), "GetSections finds the section table" + layout);
+    Check((sections.size() == testSections.size()), "GetSections returns every section" + layout);
+
+    for (size_t i = 0; (i < sections.size()) && (i < testSections.size()); i++)
+    {
+        Check((sections[i].Name == testSections[i].Name), "Section name of " + testSections[i].Name + layout);
+        Check((sections[i].Offset == testSections[i].GetOffset(bMapped)), "Section offset of " + testSections[i].Name + layout);
+        Check((sections[i].Size == (bMapped ? testSections[i].VirtualSize : testSections[i].RawSize)), "Section size of " + testSections[i].Name + layout);
+    }
+
+    if (sections.size() == testSections.size())
+    {
+        Check((sections[0].IsType(Scanner::ESectionType::Code) && !sections[0].IsType(Scanner::ESectionType::Data)), ".text is only code" + layout);
+        Check((!sections[1].IsType(Scanner::ESectionType::Code) && sections[1].IsType(Scanner::ESectionType::Data)), ".data is only data" + layout);
+        Check((!sections[2].IsType(Scanner::ESectionType::Code) && !sections[2].IsType(Scanner::ESectionType::Data)), "Discardable .reloc is neither code nor data" + layout);
+        Check((sections[2].IsType(Scanner::ESectionType::Any)), "Every section is any" + layout);
+    }
+
+    const uint8_t* text = (image.data() + testSections[0].GetOffset(bMapped));
+    const uint8_t* data = (image.data() + testSections[1].GetOffset(bMapped));
+    const uint8_t* reloc = (image.data() + testSections[2].GetOffset(bMapped));
+
+    std::vector<Scanner::FPattern> patterns = {
+        { CODE_PATTERN, CODE_MASK, Scanner::ESectionType::Code },
+        { DATA_PATTERN, DATA_MASK, Scanner::ESectionType::Data },
+        { DATA_PATTERN, DATA_MASK, Scanner::ESectionType::Any },
+        { RELOC_PATTERN, RELOC_MASK, Scanner::ESectionType::Data },
+        { RELOC_PATTERN, RELOC_MASK, Scanner::ESectionType::Any },
+        { CODE_PATTERN, CODE_MASK, Scanner::ESectionType::Data }
+    };
+
+    std::vector<const uint8_t*> results = Scanner::FindInImage(image.data(), image.size(), bMapped, patterns);
+    Check((results.size() == patterns.size()), "FindInImage returns a result for every pattern" + layout);
+
+    if (results.size() == patterns.size())
+    {
+        Check((results[0] == (text + 0x100)), "Code pattern is found in .text" + layout);
+        Check((results[1] == (data + 0x80)), "Data pattern skips .text and is found in .data" + layout);
+        Check((results[2] == (text + 0x300)), "Any pattern is found at its lowest address" + layout);
+        Check((results[3] == nullptr), "Data pattern skips discardable sections" + layout);
+        Check((results[4] == (reloc + 0x40)), "Any pattern searches discardable sections" + layout);
+        Check((results[5] == (data + 0x200)), "Code bytes searched as data skip .text" + layout);
+    }
+}
+
+static void TestChunkBoundary(uint32_t threadCount)
+{
+    const std::string threads = (" (" + std::to_string(threadCount) + " threads)");
+    const FTestSection textSection = { ".text", 0x1000, static_cast<uint32_t>(TEST_CHUNK_SIZE * 3), 0x400, static_cast<uint32_t>(TEST_CHUNK_SIZE * 3), TEST_CODE };
+    std::vector<uint8_t> image = CreateImage({ textSection }, true);
+
+    size_t straddle = ((TEST_CHUNK_SIZE * 2) - (sizeof(CODE_PATTERN) / 2)); // Starts in the second chunk and ends in the third.
+    size_t lastByte = ((TEST_CHUNK_SIZE * 3) - sizeof(DATA_PATTERN)); // Ends on the last byte of the section.
+    Plant(image, textSection, true, straddle, CODE_PATTERN, sizeof(CODE_PATTERN));
+    Plant(image, textSection, true, lastByte, DATA_PATTERN, sizeof(DATA_PATTERN));
+
+    std::vector<Scanner::FPattern> patterns = {
+        { CODE_PATTERN, CODE_MASK, Scanner::ESectionType::Code },
+        { DATA_PATTERN, DATA_MASK, Scanner::ESectionType::Code }
+    };
+
+    GScheduler::Start(threadCount);
+    std::vector<const uint8_t*> results = Scanner::FindInImage(image.data(), image.size(), true, patterns);
+    GScheduler::Stop();
+
+    const uint8_t* text = (image.data() + textSection.VirtualAddress);
+    Check(((results.size() == 2) && (results[0] == (text + straddle))), "Match across a chunk boundary is found" + threads);
+    Check(((results.size() == 2) && (results[1] == (text + lastByte))), "Match at the end of the last chunk is found" + threads);
+}
+
+static void TestFallback()
+{
+    std::mt19937_64 generator(1);
+    std::vector<uint8_t> buffer(0x10000);
+
+    for (uint8_t& bufferByte : buffer)
+    {
+        bufferByte = static_cast<uint8_t>(generator() & 0x3F); // Keeps every byte of the patterns out of the noise.
+    }
+
+    std::memcpy(&buffer[0x8000], CODE_PATTERN, sizeof(CODE_PATTERN));
+    std::memcpy(&buffer[0xC000], DATA_PATTERN, sizeof(DATA_PATTERN));
+
+    std::vector<Scanner::FPattern> patterns = {
+        { CODE_PATTERN, CODE_MASK, Scanner::ESectionType::Code },
+        { DATA_PATTERN, DATA_MASK, Scanner::ESectionType::Data }
+    };
+
+    std::vector<Scanner::FSection> sections;
+    Check(!Scanner::GetSections(buffer.data(), buffer.size(), false, sections), "GetSections fails without a pe header");
+
+    std::vector<const uint8_t*> results = Scanner::FindInImage(buffer.data(), buffer.size(), false, patterns);
+    Check(((results.size() == 2) && (results[0] == &buffer[0x8000]) && (results[1] == &buffer[0xC000])), "FindInImage scans the whole buffer without a pe header");
+
+    // Valid dos header, but the pe header it points to is past the end of the buffer.
+    WriteValue<uint16_t>(buffer, 0x0, 0x5A4D);
+    WriteValue<uint32_t>(buffer, 0x3C, 0xFFFFFF00);
+    Check(!Scanner::GetSections(buffer.data(), buffer.size(), false, sections), "GetSections fails with a truncated pe header");
+
+    results = Scanner::FindInImage(buffer.data(), buffer.size(), false, patterns);
+    Check(((results.size() == 2) && (results[0] == &buffer[0x8000]) && (results[1] == &buffer[0xC000])), "FindInImage scans the whole buffer with a truncated pe header");
+}
+
+static void TestModuleKey()
+{
+    const FTestSection textSection = { ".text", 0x1000, 0x800, 0x400, 0x800, TEST_CODE };
+    std::vector<uint8_t> image = CreateImage({ textSection }, true);
+    WriteValue<uint32_t>(image, (TEST_PE_OFFSET + 0x8), 0x5F3759DF); // TimeDateStamp
+    WriteValue<uint32_t>(image, (TEST_PE_OFFSET + 0x50), 0x1800); // SizeOfImage
+    WriteValue<uint32_t>(image, (TEST_PE_OFFSET + 0x58), 0x0001D2C4); // CheckSum
+
+    Scanner::FModuleKey moduleKey{};
+    Check((Scanner::GetModuleKey(image.data(), image.size(), moduleKey) && (moduleKey.TimeDateStamp == 0x5F3759DF) && (moduleKey.SizeOfImage == 0x1800) && (moduleKey.CheckSum == 0x0001D2C4)), "Module key is read from the pe headers");
+
+    // The loader writes base relocations into code when a module is rebased, which can't be allowed to change the key.
+    Plant(image, textSection, true, 0x100, CODE_PATTERN, sizeof(CODE_PATTERN));
+    Scanner::FModuleKey rebasedKey{};
+    Check((Scanner::GetModuleKey(image.data(), image.size(), rebasedKey) && (rebasedKey == moduleKey)), "Module key ignores changes to code");
+
+    WriteValue<uint32_t>(image, (TEST_PE_OFFSET + 0x8), 0x5F3759E0);
+    Scanner::FModuleKey patchedKey{};
+    Check((Scanner::GetModuleKey(image.data(), image.size(), patchedKey) && !(patchedKey == moduleKey)), "Module key changes with the timestamp");
+
+    std::vector<uint8_t> buffer(0x1000, 0);
+    Check(!Scanner::GetModuleKey(buffer.data(), buffer.size(), patchedKey), "Module key fails without a pe header");
+}
+
+static void TestFindAll()
+{
+    // 0xA7 isn't a common byte, so it's the rarest byte of every pattern here and they all end up in the same bucket.
+    static const uint8_t SHARED_FIRST[] = { 0x48, 0x8B, 0xA7, 0x00 };
+    static const uint8_t SHARED_SECOND[] = { 0xA7, 0x89, 0x24, 0x20 };
+    static const uint8_t SHARED_WILDCARD[] = { 0x0F, 0x85, 0x00, 0xA7 };
+    static const uint8_t SHARED_MISSING[] = { 0xA7, 0xFF, 0xFF, 0xCC };
+    static const uint8_t SHARED_TAIL[] = { 0xE8, 0xA7, 0x44, 0x4C, 0x85 };
+    static const uint8_t NEAR_MISS[] = { 0x48, 0x8B, 0xA7, 0x01 };
+
+    std::mt19937_64 generator(2);
+    std::vector<uint8_t> buffer(0x2000 + 13); // Leaves 13 bytes after the last full block, for both sixteen and thirty two byte blocks.
+
+    for (uint8_t& bufferByte : buffer)
+    {
+        bufferByte = static_cast<uint8_t>(generator() & 0x3F); // Never 0xA7, so the only matches are the ones planted.
+    }
+
+    std::memcpy(&buffer[0x300], NEAR_MISS, sizeof(NEAR_MISS)); // Same rarest byte and almost the same pattern, right before the real one.
+    std::memcpy(&buffer[0x310], SHARED_FIRST, sizeof(SHARED_FIRST));
+    std::memcpy(&buffer[0x7F0], SHARED_SECOND, sizeof(SHARED_SECOND));
+    std::memcpy(&buffer[0x1400], SHARED_SECOND, sizeof(SHARED_SECOND)); // Only the first one should be returned.
+    std::memcpy(&buffer[0x1A1F], SHARED_WILDCARD, sizeof(SHARED_WILDCARD)); // Crosses from one block into the next.
+    std::memcpy(&buffer[buffer.size() - sizeof(SHARED_TAIL)], SHARED_TAIL, sizeof(SHARED_TAIL));
+
+    std::vector<Scanner::FPattern> patterns = {
+        { SHARED_FIRST, "xxxx" },
+        { SHARED_SECOND, "xxxx" },
+        { SHARED_WILDCARD, "xx?x" },
+        { SHARED_MISSING, "xxxx" },
+        { SHARED_TAIL, "xxxxx" }
+    };
+
+    std::vector<const uint8_t*> expected;
+
+    for (const Scanner::FPattern& pattern : patterns)
+    {
+        expected.push_back(Scanner::FindScalar(buffer.data(), buffer.size(), pattern.Pattern, pattern.Mask));
+    }
+
+    Check((expected[0] == &buffer[0x310]), "FindScalar skips the near miss");
+    Check((expected[1] == &buffer[0x7F0]), "FindScalar finds the first of two matches");
+    Check((expected[2] == &buffer[0x1A1F]), "FindScalar finds the pattern with a wildcard");
+    Check((expected[3] == nullptr), "FindScalar doesn't find the missing pattern");
+    Check((expected[4] == &buffer[buffer.size() - sizeof(SHARED_TAIL)]), "FindScalar finds the pattern at the end");
+
+    std::vector<std::pair<std::string, std::vector<const uint8_t*>(*)(const uint8_t*, size_t, const std::vector<Scanner::FPattern>&)>> searches = {
+        { "FindAllScalar", Scanner::FindAllScalar },
+        { "FindAll", Scanner::FindAll }
+    };
+
+    if (Scanner::HasSSE2())
+    {
+        searches.emplace_back("FindAllSSE2", Scanner::FindAllSSE2);
+    }
+
+    if (Scanner::HasAVX2())
+    {
+        searches.emplace_back("FindAllAVX2", Scanner::FindAllAVX2);
+    }
+
+    for (const auto& search : searches)
+    {
+        Check((search.second(buffer.data(), buffer.size(), patterns) == expected), search.first + " finds the same matches as FindScalar, for patterns sharing a rarest byte");
+    }
+}
+
+static void TestSignatures()
+{
+    static constexpr Scanner::FSignature parsed("48 8b 05 ? ?? 0F", { Scanner::Add(3), Scanner::Rip() });
+    static constexpr Scanner::FSignature empty("");
+    static constexpr uint8_t PARSED_BYTES[] = { 0x48, 0x8B, 0x05, 0x00, 0x00, 0x0F };
+
+    Check(((parsed.Length == sizeof(PARSED_BYTES)) && (std::memcmp(parsed.Bytes, PARSED_BYTES, sizeof(PARSED_BYTES)) == 0)), "Signature bytes are parsed from either case of hex");
+    Check((std::string(parsed.Mask, parsed.Length) == "xxx??x"), "Signature mask treats both \"?\" and \"??\" as one wildcard");
+    Check(((parsed.StepCount == 2) && (parsed.Steps[0].Type == Scanner::EResolveType::Add) && (parsed.Steps[0].Value == 3) && (parsed.Steps[1].Type == Scanner::EResolveType::Rip) && (parsed.Steps[1].Value == 4)), "Signature steps are kept in order");
+    Check(((parsed.ToPattern(Scanner::ESectionType::Code).Mask == "xxx??x") && !parsed.IsEmpty() && empty.IsEmpty()), "Signature converts to a pattern");
+
+    // "mov rax, [rip + displacement]" at 0x100, which points to a global at 0x800.
+    static constexpr Scanner::FSignature global("48 8B 05 ?? ?? ?? ?? 48 8B 0C C8", { Scanner::Add(3), Scanner::Rip() });
+    static constexpr size_t INSTRUCTION_OFFSET = 0x100;
+    static constexpr size_t GLOBAL_OFFSET = 0x800;
+    std::vector<uint8_t> image(0x1000, 0);
+
+    std::memcpy(&image[INSTRUCTION_OFFSET], global.Bytes, global.Length);
+    WriteValue<int32_t>(image, (INSTRUCTION_OFFSET + 3), static_cast<int32_t>(GLOBAL_OFFSET - (INSTRUCTION_OFFSET + 7)));
+
+    Scanner::FPattern globalPattern = global.ToPattern(Scanner::ESectionType::Code);
+    const uint8_t* found = Scanner::Find(image.data(), image.size(), globalPattern.Pattern, globalPattern.Mask);
+    Check((found == &image[INSTRUCTION_OFFSET]), "Signature is found where it was planted");
+    Check((Scanner::Resolve(image.data(), image.size(), reinterpret_cast<uintptr_t>(found), global) == reinterpret_cast<uintptr_t>(&image[GLOBAL_OFFSET])), "Add then rip lands on the global");
+
+    static constexpr Scanner::FSignature dereference("00", { Scanner::Deref() });
+    WriteValue<uintptr_t>(image, GLOBAL_OFFSET, 0x12345678);
+    Check((Scanner::Resolve(image.data(), image.size(), reinterpret_cast<uintptr_t>(&image[GLOBAL_OFFSET]), dereference) == 0x12345678), "Deref reads the pointer inside the image");
+
+    // Reads that start inside the image but end past it, along with ones that start outside of it entirely.
+    static constexpr Scanner::FSignature ripPastEnd("00", { Scanner::Add(2), Scanner::Rip() });
+    static constexpr Scanner::FSignature derefPastEnd("00", { Scanner::Deref() });
+    static constexpr Scanner::FSignature ripOutside("00", { Scanner::Add(0x2000), Scanner::Rip() });
+    uintptr_t nearEnd = reinterpret_cast<uintptr_t>(&image[image.size() - 4]);
+
+    Check((Scanner::Resolve(image.data(), image.size(), nearEnd, ripPastEnd) == 0), "Rip reading past the end of the image resolves to null");
+    Check((Scanner::Resolve(image.data(), image.size(), nearEnd, derefPastEnd) == 0), "Deref reading past the end of the image resolves to null");
+    Check((Scanner::Resolve(image.data(), image.size(), reinterpret_cast<uintptr_t>(image.data()), ripOutside) == 0), "Rip outside of the image resolves to null");
+}
+
+int main()
+{
+    TestSections(false);
+    TestSections(true);
+    TestChunkBoundary(1);
+    TestChunkBoundary(4);
+    TestFallback();
+    TestModuleKey();
+    TestFindAll();
+    TestSignatures();
+
+    std::cout << (m_checks - m_failures) << "/" << m_checks << " scanner checks passed." << std::endl;
+    return ((m_failures == 0) ? EXIT_SUCCESS : EXIT_FAILURE);
+}
\ No newline at end of file
@@ -4,6 +4,9 @@ static constexpr uint32_t UNKNOWN_DATA_SPACING = 2;
 static constexpr uint32_t LOG_FILE_SPACING = 75;
 static constexpr uint32_t CONST_VALUE_SPACING = 175;
 static constexpr uint32_t INSTANCE_DUMP_SPACING = 50;
+static constexpr uint64_t FNV_OFFSET_BASIS = 0xCBF29CE484222325;
+static constexpr uint64_t FNV_PRIME = 0x100000001B3;
+static constexpr uint32_t FINGERPRINT_VERSION = 1; // Bump this whenever a change to the generator changes what it prints, so every package gets generated again.
 
 std::vector<char> UnrealObject::m_unsafeChars = {
     '`',
@@ -49,11 +52,11 @@ std::vector<std::string> UnrealObject::m_unsafeNames = {
     "PlaySound"
 };
 
-UnrealObject::UnrealObject() : Type(EClassTypes::Unknown), Object(nullptr), Package(nullptr) {}
+UnrealObject::UnrealObject() : Type(EClassTypes::Unknown), Object(nullptr), Package(nullptr), m_hash(0) {}
 
-UnrealObject::UnrealObject(class UObject* uObject, bool bIsPackage) : Type(EClassTypes::Unknown), Object(nullptr), Package(nullptr)
+UnrealObject::UnrealObject(class UObject* uObject, bool bIsPackage, bool bDeferName) : Type(EClassTypes::Unknown), Object(nullptr), Package(nullptr), m_hash(0)
 {
-    Assign(uObject, bIsPackage);
+    Assign(uObject, bIsPackage, bDeferName);
 }
 
 UnrealObject::UnrealObject(const UnrealObject& unrealObj) :
@@ -61,7 +64,8 @@ UnrealObject::UnrealObject(const UnrealObject& unrealObj) :
     Object(unrealObj.Object),
     Package(unrealObj.Package),
     FullName(unrealObj.FullName),
-    ValidName(unrealObj.ValidName)
+    ValidName(unrealObj.ValidName),
+    m_hash(unrealObj.m_hash)
 {
 
 }
@@ -73,14 +77,37 @@ bool UnrealObject::IsValid() const
     return ((Type != EClassTypes::Unknown) && Object && Package);
 }
 
-std::string UnrealObject::Hash() const
+uint64_t UnrealObject::Hash() const
 {
-    if (IsValid())
+    return m_hash;
+}
+
+// Consts and enums share name maps to avoid collisions, so their names are generated separately from the rest in case the object was created on a worker thread.
+// This should only be called once per object, and only if it was created with "bDeferName" set to true.
+void UnrealObject::ResolveName()
+{
+    if ((Type == EClassTypes::UConst) || (Type == EClassTypes::UEnum))
     {
-        return (std::to_string(static_cast<int32_t>(Type)) + "." + FullName + "." + ValidName);
-    }
+        if (Type == EClassTypes::UConst)
+        {
+            ConstGenerator::GenerateConstName(this);
+        }
+        else
+        {
+            EnumGenerator::GenerateEnumName(this);
+        }
+
+        if (ValidName.empty())
+        {
+            Type = EClassTypes::Unknown;
+        }
+        else
+        {
+            ValidateName(ValidName);
+        }
 
-    return "";
+        AssignHash();
+    }
 }
 
 void UnrealObject::ValidateName(std::string& name)
@@ -110,7 +137,7 @@ std::string UnrealObject::CreateValidName(std::string name)
     return name;
 }
 
-void UnrealObject::Assign(class UObject* uObject, bool bIsPackage)
+void UnrealObject::Assign(class UObject* uObject, bool bIsPackage, bool bDeferName)
 {
     if (uObject)
     {
@@ -120,7 +147,7 @@ void UnrealObject::Assign(class UObject* uObject, bool bIsPackage)
         {
             Object = uObject;
             Package = packageObj;
-            FullName = Object->GetFullName();
+            FullName = GCache::GetFullName(Object);
             ValidName = Object->GetName();
 
             if (!bIsPackage)
@@ -132,7 +159,8 @@ void UnrealObject::Assign(class UObject* uObject, bool bIsPackage)
                 Type = EClassTypes::UObject;
             }
 
-            AssignName();
+            AssignName(bDeferName);
+            AssignHash();
         }
     }
 }
@@ -141,50 +169,49 @@ void UnrealObject::AssignType()
 {
     if (Object)
     {
-        if (Object->IsA<UConst>())
-        {
-            ConstGenerator::GenerateConstName(this);
+        uint32_t ancestry = GCache::GetAncestry(Object->Class);
 
-            if (!ValidName.empty())
-            {
-                Type = EClassTypes::UConst;
-            }
+        if (ancestry & ANCESTRY_Const)
+        {
+            Type = EClassTypes::UConst; // Name is generated in "ResolveName".
         }
-        else if (Object->IsA<UEnum>())
+        else if (ancestry & ANCESTRY_Enum)
         {
-            EnumGenerator::GenerateEnumName(this);
-
-            if (!ValidName.empty())
-            {
-                Type = EClassTypes::UEnum;
-            }
+            Type = EClassTypes::UEnum;
         }
-        else if (Object->IsA<UScriptStruct>())
+        else if (ancestry & ANCESTRY_ScriptStruct)
         {
             if ((ValidName.find("Default__") == std::string::npos) && (ValidName.find("<uninitialized>") == std::string::npos))
             {
                 Type = EClassTypes::UStruct;
             }
         }
-        else if (Object->IsA<UClass>())
+        else if (ancestry & ANCESTRY_Class)
         {
             if ((ValidName.find("Default__") == std::string::npos) && (ValidName.find("<uninitialized>") == std::string::npos))
             {
                 Type = EClassTypes::UClass;
             }
         }
-        else if (Object->IsA<UFunction>())
+        else if (ancestry & ANCESTRY_Function)
         {
             Type = EClassTypes::UFunction;
         }
     }
 }
 
-void UnrealObject::AssignName()
+void UnrealObject::AssignName(bool bDeferName)
 {
     ValidateName(FullName);
 
-    if (!ValidName.empty())
+    if ((Type == EClassTypes::UConst) || (Type == EClassTypes::UEnum))
+    {
+        if (!bDeferName)
+        {
+            ResolveName();
+        }
+    }
+    else if (!ValidName.empty())
     {
         ValidateName(ValidName);
 
@@ -202,22 +229,35 @@ void UnrealObject::AssignName()
     }
 }
 
-bool UnrealObject::operator>(const UnrealObject& unrealObj)
+void UnrealObject::AssignHash()
+{
+    if (IsValid())
+    {
+        // Each name seeds the next one, same as the old "Type.FullName.ValidName" string but without ever putting it together.
+        m_hash = Utils::Hash(ValidName, Utils::Hash(FullName, static_cast<uint64_t>(Type)));
+    }
+    else
+    {
+        m_hash = 0;
+    }
+}
+
+bool UnrealObject::operator>(const UnrealObject& unrealObj) const
 {
     return (Hash() > unrealObj.Hash());
 }
 
-bool UnrealObject::operator<(const UnrealObject& unrealObj)
+bool UnrealObject::operator<(const UnrealObject& unrealObj) const
 {
     return (Hash() < unrealObj.Hash());
 }
 
-bool UnrealObject::operator==(const UnrealObject& unrealObj)
+bool UnrealObject::operator==(const UnrealObject& unrealObj) const
 {
     return (Hash() == unrealObj.Hash());
 }
 
-bool UnrealObject::operator!=(const UnrealObject& unrealObj)
+bool UnrealObject::operator!=(const UnrealObject& unrealObj) const
 {
     return (Hash() != unrealObj.Hash());
 }
@@ -229,17 +269,18 @@ UnrealObject& UnrealObject::operator=(const UnrealObject& unrealObj)
     Package = unrealObj.Package;
     FullName = unrealObj.FullName;
     ValidName = unrealObj.ValidName;
+    m_hash = unrealObj.m_hash;
     return *this;
 }
 
-UnrealProperty::UnrealProperty() : Type(EPropertyTypes::Unknown), Property(nullptr) {}
+UnrealProperty::UnrealProperty() : Type(EPropertyTypes::Unknown), Property(nullptr), m_hash(0) {}
 
-UnrealProperty::UnrealProperty(class UProperty* uProperty) : Type(EPropertyTypes::Unknown), Property(nullptr)
+UnrealProperty::UnrealProperty(class UProperty* uProperty) : Type(EPropertyTypes::Unknown), Property(nullptr), m_hash(0)
 {
     Assign(uProperty);
 }
 
-UnrealProperty::UnrealProperty(const UnrealProperty& unrealProp) : Type(unrealProp.Type), Property(unrealProp.Property), ValidName(unrealProp.ValidName) {}
+UnrealProperty::UnrealProperty(const UnrealProperty& unrealProp) : Type(unrealProp.Type), Property(unrealProp.Property), ValidName(unrealProp.ValidName), m_hash(unrealProp.m_hash) {}
 
 UnrealProperty::~UnrealProperty() {}
 
@@ -248,14 +289,9 @@ bool UnrealProperty::IsValid() const
     return ((Type != EPropertyTypes::Unknown) && Property && (Property->ElementSize > 0));
 }
 
-std::string UnrealProperty::Hash() const
+uint64_t UnrealProperty::Hash() const
 {
-    if (IsValid())
-    {
-        return (std::to_string(static_cast<int32_t>(Type)) + "." + std::to_string(reinterpret_cast<uintptr_t>(Property)) + "." + ValidName);
-    }
-
-    return "";
+    return m_hash;
 }
 
 bool UnrealProperty::IsContainer() const
@@ -534,7 +570,9 @@ std::string UnrealProperty::GetType(bool bIgnoreEnum, bool bFunctionParam, bool
                     }
                     else
                     {
-                        typeStr = ("struct " + UnrealObject::CreateValidName(structProperty->Struct->GetNameCPP()) + "_Outer" + Printer::Decimal(propertyCount, EWidthTypes::Byte));
+                        Printer::NumberBuffer numberBuffer;
+                        typeStr = ("struct " + UnrealObject::CreateValidName(structProperty->Struct->GetNameCPP()) + "_Outer");
+                        typeStr.append(Printer::Decimal(numberBuffer, propertyCount, EWidthTypes::Byte));
                     }
                 }
                 else
@@ -659,6 +697,7 @@ void UnrealProperty::Assign(class UProperty* uProperty)
         ValidName = uProperty->GetName();
         AssignType();
         AssignName();
+        AssignHash();
     }
 }
 
@@ -666,7 +705,9 @@ void UnrealProperty::AssignType()
 {
     if (Property)
     {
-        if (Property->IsA<UStructProperty>())
+        uint32_t ancestry = GCache::GetAncestry(Property->Class); // One lookup for the whole chain below instead of walking the super classes for each check.
+
+        if (ancestry & ANCESTRY_StructProperty)
         {
             UStructProperty* structProperty = static_cast<UStructProperty*>(Property);
 
@@ -675,19 +716,19 @@ void UnrealProperty::AssignType()
                 Type = EPropertyTypes::FStruct;
             }
         }
-        else if (Property->IsA<UStrProperty>())
+        else if (ancestry & ANCESTRY_StrProperty)
         {
             Type = EPropertyTypes::FString;
         }
-        else if (Property->IsA<UQWordProperty>())
+        else if (ancestry & ANCESTRY_QWordProperty)
         {
             Type = EPropertyTypes::UInt64;
         }
-        else if (Property->IsA<USQWordProperty>())
+        else if (ancestry & ANCESTRY_SQWordProperty)
         {
             Type = EPropertyTypes::Int64;
         }
-        else if (Property->IsA<UObjectProperty>())
+        else if (ancestry & ANCESTRY_ObjectProperty)
         {
             UObjectProperty* objectProperty = static_cast<UObjectProperty*>(Property);
 
@@ -696,7 +737,7 @@ void UnrealProperty::AssignType()
                 Type = EPropertyTypes::UObject;
             }
         }
-        else if (Property->IsA<UClassProperty>())
+        else if (ancestry & ANCESTRY_ClassProperty)
         {
             UClassProperty* classProperty = static_cast<UClassProperty*>(Property);
 
@@ -705,7 +746,7 @@ void UnrealProperty::AssignType()
                 Type = EPropertyTypes::UClass;
             }
         }
-        else if (Property->IsA<UInterfaceProperty>())
+        else if (ancestry & ANCESTRY_InterfaceProperty)
         {
             UInterfaceProperty* interfaceProperty = static_cast<UInterfaceProperty*>(Property);
 
@@ -714,11 +755,11 @@ void UnrealProperty::AssignType()
                 Type = EPropertyTypes::UInterface;
             }
         }
-        else if (Property->IsA<UNameProperty>())
+        else if (ancestry & ANCESTRY_NameProperty)
         {
             Type = EPropertyTypes::FName;
         }
-        else if (Property->IsA<UMapProperty>())
+        else if (ancestry & ANCESTRY_MapProperty)
         {
             UMapProperty* mapProperty = static_cast<UMapProperty*>(Property);
             std::string mapKey, mapValue;
@@ -731,27 +772,27 @@ void UnrealProperty::AssignType()
                 }
             }
         }
-        else if (Property->IsA<UIntProperty>())
+        else if (ancestry & ANCESTRY_IntProperty)
         {
             Type = EPropertyTypes::Int32;
         }
-        else if (Property->IsA<UFloatProperty>())
+        else if (ancestry & ANCESTRY_FloatProperty)
         {
             Type = EPropertyTypes::Float;
         }
-        else if (Property->IsA<UDelegateProperty>())
+        else if (ancestry & ANCESTRY_DelegateProperty)
         {
             Type = EPropertyTypes::FScriptDelegate;
         }
-        else if (Property->IsA<UByteProperty>())
+        else if (ancestry & ANCESTRY_ByteProperty)
         {
             Type = EPropertyTypes::UInt8;
         }
-        else if (Property->IsA<UBoolProperty>())
+        else if (ancestry & ANCESTRY_BoolProperty)
         {
             Type = EPropertyTypes::Bool;
         }
-        else if (Property->IsA<UArrayProperty>())
+        else if (ancestry & ANCESTRY_ArrayProperty)
         {
             UArrayProperty* arrayProperty = static_cast<UArrayProperty*>(Property);
 
@@ -773,22 +814,35 @@ void UnrealProperty::AssignName()
     UnrealObject::ValidateName(ValidName);
 }
 
-bool UnrealProperty::operator>(const UnrealProperty& unrealProp)
+void UnrealProperty::AssignHash()
+{
+    if (IsValid())
+    {
+        // The name comes from the property itself, so the pointer and type are all that's needed to tell them apart.
+        m_hash = ((static_cast<uint64_t>(reinterpret_cast<uintptr_t>(Property)) << 8) | static_cast<uint8_t>(Type));
+    }
+    else
+    {
+        m_hash = 0;
+    }
+}
+
+bool UnrealProperty::operator>(const UnrealProperty& unrealProp) const
 {
     return (Hash() > unrealProp.Hash());
 }
 
-bool UnrealProperty::operator<(const UnrealProperty& unrealProp)
+bool UnrealProperty::operator<(const UnrealProperty& unrealProp) const
 {
     return (Hash() < unrealProp.Hash());
 }
 
-bool UnrealProperty::operator==(const UnrealProperty& unrealProp)
+bool UnrealProperty::operator==(const UnrealProperty& unrealProp) const
 {
     return (Hash() == unrealProp.Hash());
 }
 
-bool UnrealProperty::operator!=(const UnrealProperty& unrealProp)
+bool UnrealProperty::operator!=(const UnrealProperty& unrealProp) const
 {
     return (Hash() != unrealProp.Hash());
 }
@@ -798,6 +852,7 @@ UnrealProperty& UnrealProperty::operator=(const UnrealProperty& unrealProp)
     Type = unrealProp.Type;
     Property = unrealProp.Property;
     ValidName = unrealProp.ValidName;
+    m_hash = unrealProp.m_hash;
     return *this;
 }
 
@@ -805,13 +860,47 @@ void GCache::Initialize()
 {
     if (m_packages.empty() && Generator::AreGlobalsValid())
     {
-        for (int32_t i = 0; i < (UObject::GObjObjects()->size() - 1); i++)
+        // Static classes and the class cache are lazily initialized and not thread safe, building the ancestry table sets them up before any workers are created.
+        CacheAncestry();
+
+        int32_t objectCount = (UObject::GObjObjects()->size() - 1);
+        int32_t threadCount = static_cast<int32_t>(Utils::GetThreadCount());
+
+        if (threadCount > objectCount)
         {
-            UObject* uObject = UObject::GObjObjects()->at(i);
+            threadCount = 1; // Not worth splitting up if there are more threads than there are objects.
+        }
 
-            if (uObject)
+        std::vector<std::vector<UnrealObject>> buckets(threadCount);
+
+        if (threadCount > 1)
+        {
+            std::vector<std::thread> workers;
+            int32_t chunkSize = ((objectCount + threadCount - 1) / threadCount);
+
+            for (int32_t i = 0; i < threadCount; i++)
+            {
+                int32_t startIndex = (i * chunkSize);
+                int32_t endIndex = (((startIndex + chunkSize) < objectCount) ? (startIndex + chunkSize) : objectCount);
+                workers.emplace_back(ScanObjects, startIndex, endIndex, &buckets[i]);
+            }
+
+            for (std::thread& worker : workers)
+            {
+                worker.join();
+            }
+        }
+        else
+        {
+            ScanObjects(0, objectCount, &buckets[0]);
+        }
+
+        // Buckets are merged in index order, so const and enum names along with everything else get cached the exact same way as a single threaded scan would.
+        for (std::vector<UnrealObject>& bucket : buckets)
+        {
+            for (UnrealObject& unrealObj : bucket)
             {
-                UnrealObject unrealObj(uObject);
+                unrealObj.ResolveName();
 
                 if (unrealObj.IsValid())
                 {
@@ -819,6 +908,15 @@ void GCache::Initialize()
                 }
             }
         }
+
+        // Packages are generated on multiple threads which only ever look these up, so every package needs its entries before then.
+        for (const UnrealObject& packageObj : m_packages)
+        {
+            m_consts.try_emplace(packageObj.Object);
+            m_enums.try_emplace(packageObj.Object);
+            m_structs.try_emplace(packageObj.Object);
+            m_classes.try_emplace(packageObj.Object);
+        }
     }
 }
 
@@ -830,7 +928,17 @@ void GCache::ClearCache()
     m_structs.clear();
     m_classes.clear();
     m_constants.clear();
+    m_constantNames.clear();
     m_packages.clear();
+    m_cachedObjects.clear();
+    m_cachedPackages.clear();
+    m_packageObjects.clear();
+    m_largestStructs.clear();
+    m_classNames.clear();
+    m_ancestry.clear();
+
+    std::unique_lock<std::shared_mutex> outerLock(m_outerMutex);
+    m_outerNames.clear();
 }
 
 std::vector<UnrealObject>* GCache::GetCache(class UObject* packageObj, EClassTypes type)
@@ -865,16 +973,20 @@ std::vector<UnrealObject>* GCache::GetPackages()
     return &m_packages;
 }
 
+size_t GCache::GetObjectCount()
+{
+    return m_cachedObjects.size();
+}
+
 std::pair<std::string, class UObject*> GCache::GetConstant(const UnrealObject& unrealObj)
 {
     if (GConfig::UsingConstants() && unrealObj.IsValid())
     {
-        for (const auto& constantPair : m_constants)
+        auto constantIt = m_constantNames.find(unrealObj.Object);
+
+        if (constantIt != m_constantNames.end())
         {
-            if (constantPair.second == unrealObj.Object)
-            {
-                return constantPair;
-            }
+            return { constantIt->second, constantIt->first };
         }
     }
 
@@ -883,43 +995,224 @@ std::pair<std::string, class UObject*> GCache::GetConstant(const UnrealObject& u
 
 UnrealObject GCache::GetLargestStruct(const std::string& structFullName)
 {
-    size_t propertySize = 0;
-    UnrealObject largestStruct;
+    auto structIt = m_largestStructs.find(structFullName);
+
+    if (structIt != m_largestStructs.end())
+    {
+        return structIt->second;
+    }
+
+    return UnrealObject();
+}
+
+UnrealObject GCache::GetClass(const std::string& classFullName)
+{
+    auto classIt = m_classNames.find(classFullName);
+
+    if (classIt != m_classNames.end())
+    {
+        return classIt->second;
+    }
+
+    return UnrealObject();
+}
+
+// Same output as "UObject::GetFullName", except the outer chain is only ever built once per outer and reused by everything inside of it.
+std::string GCache::GetFullName(class UObject* uObject)
+{
+    std::string fullName;
+
+    if (uObject)
+    {
+        fullName = uObject->Class->Name.ToStringView();
+        fullName += " ";
+
+        if (uObject->Outer)
+        {
+            fullName += GetOuterName(uObject->Outer);
+            fullName += ".";
+        }
+
+        fullName += uObject->Name.ToStringView();
+    }
+
+    return fullName;
+}
+
+const std::string& GCache::GetOuterName(class UObject* uOuter)
+{
+    {
+        std::shared_lock<std::shared_mutex> outerLock(m_outerMutex);
+        auto outerIt = m_outerNames.find(uOuter);
+
+        if (outerIt != m_outerNames.end())
+        {
+            return outerIt->second; // Elements in an unordered map never move, so this is safe to hold onto after unlocking.
+        }
+    }
+
+    std::string outerName;
+
+    if (uOuter->Outer)
+    {
+        outerName = (GetOuterName(uOuter->Outer) + ".");
+    }
+
+    outerName += uOuter->Name.ToStringView();
+
+    std::unique_lock<std::shared_mutex> outerLock(m_outerMutex);
+    return m_outerNames.emplace(uOuter, std::move(outerName)).first->second; // If another thread got here first their name is kept, both are the same anyway.
+}
+
+uint32_t GCache::GetAncestry(class UClass* uClass)
+{
+    if (uClass)
+    {
+        auto ancestryIt = m_ancestry.find(uClass);
+
+        if (ancestryIt != m_ancestry.end())
+        {
+            return ancestryIt->second;
+        }
+
+        return CreateAncestry(uClass); // Not inserted here so reading the table stays thread safe, only classes created after the scan should ever get here.
+    }
+
+    return ANCESTRY_None;
+}
+
+bool GCache::IsA(class UObject* uObject, EAncestryFlags ancestryFlag)
+{
+    if (uObject)
+    {
+        return (GetAncestry(uObject->Class) & ancestryFlag);
+    }
+
+    return false;
+}
+
+uint64_t GCache::GetFingerprint(const UnrealObject& unrealObj, uint64_t seed)
+{
+    uint64_t fingerprint = Utils::Hash(unrealObj.FullName, seed);
+    fingerprint = Utils::Hash(unrealObj.ValidName, fingerprint);
 
-    for (auto& classPair : m_structs)
+    if (unrealObj.IsValid())
     {
-        for (UnrealObject& unrealObj : classPair.second)
+        if (IsA(unrealObj.Object, ANCESTRY_Const))
         {
-            if (unrealObj.FullName == structFullName)
+            fingerprint = Utils::Hash(static_cast<UConst*>(unrealObj.Object)->Value.ToString(), fingerprint);
+        }
+        else if (IsA(unrealObj.Object, ANCESTRY_Enum))
+        {
+            UEnum* uEnum = static_cast<UEnum*>(unrealObj.Object);
+
+            for (int32_t i = 0; i < uEnum->Names.size(); i++)
             {
-                UScriptStruct* scriptStruct = static_cast<UScriptStruct*>(unrealObj.Object);
+                fingerprint = Utils::Hash(std::string(uEnum->Names[i].ToStringView()), fingerprint);
+            }
+        }
+        else if (IsA(unrealObj.Object, ANCESTRY_Struct))
+        {
+            // Blacklists and overrides are set per type in the config, which is the only part of the config that isn't global.
+            std::string nameCPP = UnrealObject::CreateValidName(unrealObj.Object->GetNameCPP());
+            fingerprint = Utils::Hash(GConfig::IsTypeBlacklisted(nameCPP), fingerprint);
+            fingerprint = Utils::Hash(GConfig::GetTypeOverride(nameCPP), fingerprint);
+            fingerprint = FingerprintStruct(static_cast<UStruct*>(unrealObj.Object), fingerprint);
+        }
+    }
 
-                if (scriptStruct->PropertySize >= propertySize)
-                {
-                    largestStruct = unrealObj;
-                    propertySize = scriptStruct->PropertySize;
-                }
+    return fingerprint;
+}
+
+uint32_t GCache::CreateAncestry(class UClass* uClass)
+{
+    const std::pair<class UClass*, EAncestryFlags> staticClasses[] = {
+        { UField::StaticClass(), ANCESTRY_Field },
+        { UEnum::StaticClass(), ANCESTRY_Enum },
+        { UConst::StaticClass(), ANCESTRY_Const },
+        { UProperty::StaticClass(), ANCESTRY_Property },
+        { UStruct::StaticClass(), ANCESTRY_Struct },
+        { UFunction::StaticClass(), ANCESTRY_Function },
+        { UScriptStruct::StaticClass(), ANCESTRY_ScriptStruct },
+        { UState::StaticClass(), ANCESTRY_State },
+        { UClass::StaticClass(), ANCESTRY_Class },
+        { UStructProperty::StaticClass(), ANCESTRY_StructProperty },
+        { UStrProperty::StaticClass(), ANCESTRY_StrProperty },
+        { UQWordProperty::StaticClass(), ANCESTRY_QWordProperty },
+        { USQWordProperty::StaticClass(), ANCESTRY_SQWordProperty },
+        { UObjectProperty::StaticClass(), ANCESTRY_ObjectProperty },
+        { UClassProperty::StaticClass(), ANCESTRY_ClassProperty },
+        { UInterfaceProperty::StaticClass(), ANCESTRY_InterfaceProperty },
+        { UNameProperty::StaticClass(), ANCESTRY_NameProperty },
+        { UMapProperty::StaticClass(), ANCESTRY_MapProperty },
+        { UIntProperty::StaticClass(), ANCESTRY_IntProperty },
+        { UFloatProperty::StaticClass(), ANCESTRY_FloatProperty },
+        { UDelegateProperty::StaticClass(), ANCESTRY_DelegateProperty },
+        { UByteProperty::StaticClass(), ANCESTRY_ByteProperty },
+        { UBoolProperty::StaticClass(), ANCESTRY_BoolProperty },
+        { UArrayProperty::StaticClass(), ANCESTRY_ArrayProperty }
+    };
+
+    uint32_t ancestry = ANCESTRY_None;
+
+    for (UClass* uSuperClass = uClass; uSuperClass; uSuperClass = reinterpret_cast<UClass*>(uSuperClass->SuperField))
+    {
+        for (const std::pair<class UClass*, EAncestryFlags>& staticClass : staticClasses)
+        {
+            if (staticClass.first && (staticClass.first == uSuperClass))
+            {
+                ancestry |= staticClass.second;
+                break;
             }
         }
     }
 
-    return largestStruct;
+    return ancestry;
 }
 
-UnrealObject GCache::GetClass(const std::string& classFullName)
+void GCache::CacheAncestry()
 {
-    for (auto& classPair : m_classes)
+    if (m_ancestry.empty())
     {
-        for (UnrealObject& unrealObj : classPair.second)
+        UObject::StaticClass(); // Isn't part of the ancestry table, but still has to be set up before packages are generated on multiple threads.
+
+        for (int32_t i = 0; i < (UObject::GObjObjects()->size() - 1); i++)
         {
-            if (unrealObj.FullName == classFullName)
+            UObject* uObject = UObject::GObjObjects()->at(i);
+
+            if (uObject && uObject->Class && !m_ancestry.contains(uObject->Class))
             {
-                return unrealObj.Object;
+                m_ancestry[uObject->Class] = CreateAncestry(uObject->Class);
             }
         }
     }
+}
 
-    return UnrealObject();
+void GCache::ScanObjects(int32_t startIndex, int32_t endIndex, std::vector<UnrealObject>* bucket)
+{
+    if (bucket)
+    {
+        for (int32_t i = startIndex; i < endIndex; i++)
+        {
+            UObject* uObject = UObject::GObjObjects()->at(i);
+
+            if (uObject)
+            {
+                UnrealObject unrealObj(uObject, false, true);
+
+                if (unrealObj.IsValid())
+                {
+                    bucket->push_back(unrealObj);
+                }
+            }
+        }
+    }
+}
+
+uint64_t GCache::CreateKey(const UnrealObject& unrealObj)
+{
+    // The package is part of the key because each package keeps its own vector, identical objects in two different packages are both cached.
+    return (unrealObj.Hash() ^ (static_cast<uint64_t>(reinterpret_cast<uintptr_t>(unrealObj.Package)) * FNV_PRIME));
 }
 
 void GCache::CacheObject(UnrealObject& unrealObj)
@@ -930,16 +1223,20 @@ void GCache::CacheObject(UnrealObject& unrealObj)
 
         if (cache)
         {
-            if (std::find(cache->begin(), cache->end(), unrealObj) == cache->end())
+            if (m_cachedObjects.insert(CreateKey(unrealObj)).second)
             {
                 cache->push_back(unrealObj);
+                CacheFullName(unrealObj);
             }
 
-            UnrealObject packageObj(unrealObj.Package, true);
-
-            if (std::find(m_packages.begin(), m_packages.end(), packageObj) == m_packages.end())
+            if (m_packageObjects.insert(unrealObj.Package).second)
             {
-                m_packages.push_back(packageObj);
+                UnrealObject packageObj(unrealObj.Package, true);
+
+                if (m_cachedPackages.insert(packageObj.Hash()).second)
+                {
+                    m_packages.push_back(packageObj);
+                }
             }
         }
 
@@ -961,23 +1258,90 @@ void GCache::CacheConstant(UnrealObject& unrealObj)
             if (!m_constants.contains(constantName))
             {
                 m_constants[constantName] = unrealObj.Object;
+                m_constantNames.emplace(unrealObj.Object, constantName);
             }
         }
     }
 }
 
-void GCache::CacheCount(UnrealObject& unrealObj)
+void GCache::CacheFullName(UnrealObject& unrealObj)
 {
     if (unrealObj.IsValid())
     {
-        std::pair<std::string, class UClass*> objectPair{ unrealObj.ValidName, unrealObj.Object->Class };
+        if (unrealObj.Type == EClassTypes::UStruct)
+        {
+            // Same rules the old full scan used, the largest struct wins and ties go to the one cached last.
+            auto structIt = m_largestStructs.find(unrealObj.FullName);
+
+            if ((structIt == m_largestStructs.end())
+                || (static_cast<UScriptStruct*>(unrealObj.Object)->PropertySize >= static_cast<UScriptStruct*>(structIt->second.Object)->PropertySize))
+            {
+                m_largestStructs[unrealObj.FullName] = unrealObj;
+            }
+        }
+        else if (unrealObj.Type == EClassTypes::UClass)
+        {
+            m_classNames.emplace(unrealObj.FullName, unrealObj);
+        }
+    }
+}
+
+// Super structs are only covered by their name and size, that's all of their layout the code generated for inheriting from them depends on.
+uint64_t GCache::FingerprintStruct(class UStruct* uStruct, uint64_t fingerprint)
+{
+    fingerprint = Utils::Hash(uStruct->PropertySize, fingerprint);
+    fingerprint = Utils::Hash(uStruct->MinAlignment, fingerprint);
+
+    if (uStruct->SuperField && (uStruct->SuperField != uStruct))
+    {
+        fingerprint = Utils::Hash(GetFullName(uStruct->SuperField), fingerprint);
+        fingerprint = Utils::Hash(static_cast<UStruct*>(uStruct->SuperField)->PropertySize, fingerprint);
+    }
+
+    for (UField* uField = uStruct->Children; uField; uField = uField->Next)
+    {
+        fingerprint = Utils::Hash(uField->GetName(), fingerprint);
 
-        if (!m_objects.contains(objectPair))
+        if (IsA(uField, ANCESTRY_Function))
+        {
+            UFunction* uFunction = static_cast<UFunction*>(uField);
+            fingerprint = Utils::Hash(uFunction->FunctionFlags, fingerprint);
+            fingerprint = Utils::Hash(uFunction->iNative, fingerprint);
+            fingerprint = FingerprintStruct(uFunction, fingerprint);
+        }
+        else if (IsA(uField, ANCESTRY_Property))
         {
-            m_objects[objectPair] = 0;
+            fingerprint = FingerprintProperty(static_cast<UProperty*>(uField), fingerprint);
         }
+    }
+
+    return fingerprint;
+}
+
+// The type string covers whatever a property points to, like the name of its struct or enum, even if it's from another package.
+uint64_t GCache::FingerprintProperty(class UProperty* uProperty, uint64_t fingerprint)
+{
+    UnrealProperty unrealProp(uProperty);
+    fingerprint = Utils::Hash(uProperty->Offset, fingerprint);
+    fingerprint = Utils::Hash(uProperty->ElementSize, fingerprint);
+    fingerprint = Utils::Hash(uProperty->ArrayDim, fingerprint);
+    fingerprint = Utils::Hash(uProperty->PropertyFlags, fingerprint);
+    fingerprint = Utils::Hash(unrealProp.GetType(false, false, false), fingerprint);
+
+    if (unrealProp.Type == EPropertyTypes::Bool)
+    {
+        fingerprint = Utils::Hash(static_cast<UBoolProperty*>(uProperty)->BitMask, fingerprint);
+    }
+
+    return fingerprint;
+}
 
-        m_objects[objectPair]++;
+void GCache::CacheCount(UnrealObject& unrealObj)
+{
+    if (unrealObj.IsValid())
+    {
+        std::pair<std::string, class UClass*> objectPair{ unrealObj.ValidName, unrealObj.Object->Class };
+        m_objects[objectPair]++; // Value initialized to zero the first time the pair is seen.
     }
 }
 
@@ -1018,43 +1382,70 @@ void GLogger::Close()
 void GLogger::Flush()
 {
 #ifndef NO_LOGGING
-    if (m_file.is_open())
+    if (m_file.is_open() && !m_buffer)
     {
         m_file.flush();
     }
 #endif
 }
 
-void GLogger::Log(const std::string& str, bool bFlush)
+std::string* GLogger::Redirect(std::string* buffer)
+{
+    std::string* previousBuffer = m_buffer;
+    m_buffer = buffer;
+    return previousBuffer;
+}
+
+void GLogger::Write(const std::string& str, bool bFlush)
 {
 #ifndef NO_LOGGING
     if (m_file.is_open() && !str.empty())
     {
-        m_file << str << "\n";
-
-        if (bFlush)
+        if (m_buffer)
+        {
+            m_buffer->append(str);
+        }
+        else
         {
-            Flush();
+            m_file << str;
+
+            if (bFlush)
+            {
+                Flush();
+            }
         }
     }
 #endif
 }
 
+void GLogger::Log(const std::string& str, bool bFlush)
+{
+#ifndef NO_LOGGING
+    if (!str.empty())
+    {
+        Write((str + "\n"), bFlush);
+    }
+#endif
+}
+
 void GLogger::LogObject(const std::string& title, const UnrealObject& unrealObj)
 {
 #ifndef NO_LOGGING
     if (m_file.is_open() && !title.empty() && unrealObj.IsValid())
     {
-        m_file << title;
-        Printer::FillRight(m_file, ' ', unrealObj.ValidName.length());
-        m_file << unrealObj.ValidName;
+        TextBuffer logStream;
+        Printer::NumberBuffer numberBuffer;
+        logStream << title;
+        Printer::FillRight(logStream, ' ', unrealObj.ValidName.length());
+        logStream << unrealObj.ValidName;
 
         if (unrealObj.ValidName.length() < LOG_FILE_SPACING)
         {
-            Printer::FillRight(m_file, ' ', (LOG_FILE_SPACING - (unrealObj.ValidName.length() + title.length())));
+            Printer::FillRight(logStream, ' ', (LOG_FILE_SPACING - (unrealObj.ValidName.length() + title.length())));
         }
 
-        m_file << " - Instance: " << Printer::Hex(unrealObj.Object) << std::endl;
+        logStream << " - Instance: " << Printer::Hex(numberBuffer, unrealObj.Object) << "\n";
+        Write(logStream.str(), true);
     }
 #endif
 }
@@ -1064,9 +1455,11 @@ void GLogger::LogClassSize(class UClass* uClass, size_t localSize)
 #ifndef NO_LOGGING
     if (m_file.is_open() && uClass)
     {
-        m_file << "Error: Incorrect class size detected for \"" << uClass->GetFullName() << "\"!\n";
-        m_file << "Error: Reported size " << localSize << "\n";
-        m_file << "Error: Actual size " << uClass->PropertySize << std::endl;
+        TextBuffer logStream;
+        logStream << "Error: Incorrect class size detected for \"" << uClass->GetFullName() << "\"!\n";
+        logStream << "Error: Reported size " << localSize << "\n";
+        logStream << "Error: Actual size " << uClass->PropertySize << "\n";
+        Write(logStream.str(), true);
     }
 #endif
 }
@@ -1076,10 +1469,13 @@ void GLogger::LogStructPadding(class UScriptStruct* uScriptStruct, size_t paddin
 #ifndef NO_LOGGING
     if (m_file.is_open() && uScriptStruct)
     {
-        m_file << "Info: Extra padding detected!\n";
-        m_file << "Info: Property size " << Printer::Hex(uScriptStruct->PropertySize, 1) << "\n";
-        m_file << "Info: Min alignment " << Printer::Hex(uScriptStruct->MinAlignment, 1) << "\n";
-        m_file << "Info: Extra padding " << Printer::Hex(padding, 1) << std::endl;
+        TextBuffer logStream;
+        Printer::NumberBuffer numberBuffer;
+        logStream << "Info: Extra padding detected!\n";
+        logStream << "Info: Property size " << Printer::Hex(numberBuffer, uScriptStruct->PropertySize, 1) << "\n";
+        logStream << "Info: Min alignment " << Printer::Hex(numberBuffer, uScriptStruct->MinAlignment, 1) << "\n";
+        logStream << "Info: Extra padding " << Printer::Hex(numberBuffer, padding, 1) << "\n";
+        Write(logStream.str(), true);
     }
 #endif
 }
@@ -1093,10 +1489,14 @@ namespace Utils
 #endif
     }
 
+    // There are no message boxes outside of windows, the offline driver prints them to the console instead.
+
     void MessageboxInfo(const std::string& message)
     {
 #ifdef _WIN32
         MessageboxExt(message, (MB_OK | MB_ICONINFORMATION));
+#else
+        std::cout << message << std::endl;
 #endif
     }
 
@@ -1104,6 +1504,8 @@ namespace Utils
     {
 #ifdef _WIN32
         MessageboxExt(message, (MB_OK | MB_ICONWARNING));
+#else
+        std::cerr << message << std::endl;
 #endif
     }
 
@@ -1111,17 +1513,89 @@ namespace Utils
     {
 #ifdef _WIN32
         MessageboxExt(message, (MB_OK | MB_ICONERROR));
+#else
+        std::cerr << message << std::endl;
 #endif
     }
 
-    bool SortProperty(const UnrealProperty& unrealPropA, const UnrealProperty& unrealPropB)
+    uint64_t Hash(const std::string& str, uint64_t seed)
     {
-        if (unrealPropA.Property && unrealPropB.Property)
+        uint64_t hash = (FNV_OFFSET_BASIS ^ seed);
+
+        for (char c : str)
         {
-            if ((unrealPropA.Property->Offset == unrealPropB.Property->Offset)
-                && (unrealPropA.Type == EPropertyTypes::Bool)
-                && (unrealPropB.Type == EPropertyTypes::Bool))
-            {
+            hash ^= static_cast<uint8_t>(c);
+            hash *= FNV_PRIME;
+        }
+
+        return hash;
+    }
+
+    uint64_t Hash(uint64_t value, uint64_t seed)
+    {
+        uint64_t hash = (FNV_OFFSET_BASIS ^ seed);
+
+        for (size_t i = 0; i < sizeof(value); i++)
+        {
+            hash ^= ((value >> (i * 8)) & 0xFF);
+            hash *= FNV_PRIME;
+        }
+
+        return hash;
+    }
+
+    uint32_t GetThreadCount()
+    {
+        uint32_t threadCount = GConfig::GetThreadCount();
+
+        if (threadCount == 0)
+        {
+            threadCount = std::thread::hardware_concurrency(); // Can still return zero if it isn't able to be detected.
+        }
+
+        return ((threadCount > 0) ? threadCount : 1);
+    }
+
+    // Each object is generated as its own task into its own buffer, then written out in the same order they were given along with anything they logged.
+    void GenerateInOrder(TextBuffer& stream, const std::vector<UnrealObject>& objects, const std::function<void(TextBuffer&, const UnrealObject&)>& generator)
+    {
+        std::vector<TextBuffer> objectStreams;
+        GenerateInOrder(objectStreams, objects, generator);
+
+        for (const TextBuffer& objectStream : objectStreams)
+        {
+            stream << objectStream;
+        }
+    }
+
+    // Same as above but leaves each object in its own stream, for when the caller wants to split them up between files.
+    void GenerateInOrder(std::vector<TextBuffer>& streams, const std::vector<UnrealObject>& objects, const std::function<void(TextBuffer&, const UnrealObject&)>& generator)
+    {
+        std::vector<std::string> objectLogs(objects.size());
+        streams.clear();
+        streams.resize(objects.size());
+
+        GScheduler::ParallelFor(objects.size(), [&](size_t objectIndex)
+        {
+            std::string* previousLog = GLogger::Redirect(&objectLogs[objectIndex]);
+            generator(streams[objectIndex], objects[objectIndex]);
+            GLogger::Redirect(previousLog);
+        });
+
+        for (const std::string& objectLog : objectLogs)
+        {
+            GLogger::Write(objectLog);
+        }
+    }
+
+    bool SortProperty(const UnrealProperty& unrealPropA, const UnrealProperty& unrealPropB)
+    {
+        if (unrealPropA.Property && unrealPropB.Property)
+        {
+            if ((unrealPropA.Property->Offset == unrealPropB.Property->Offset)
+                && (unrealPropA.Type == EPropertyTypes::Bool)
+                && (unrealPropB.Type == EPropertyTypes::Bool))
+            {
                 return (static_cast<UBoolProperty*>(unrealPropA.Property)->BitMask < static_cast<UBoolProperty*>(unrealPropB.Property)->BitMask);
             }
 
@@ -1139,7 +1613,7 @@ namespace Utils
 
 namespace Retrievers
 {
-    void GetAllFunctionFlags(std::ostringstream& stream, uint64_t functionFlags)
+    void GetAllFunctionFlags(TextBuffer& stream, uint64_t functionFlags)
     {
         bool first = true;
 
@@ -1183,7 +1657,7 @@ namespace Retrievers
         }
     }
 
-    void GetAllPropertyFlags(std::ostringstream& stream, uint64_t propertyFlags)
+    void GetAllPropertyFlags(TextBuffer& stream, uint64_t propertyFlags)
     {
         bool first = true;
 
@@ -1237,7 +1711,7 @@ namespace Retrievers
         }
     }
 
-    void GetAllObjectFlags(std::ostringstream& stream, uint64_t objectFlags)
+    void GetAllObjectFlags(TextBuffer& stream, uint64_t objectFlags)
     {
         bool first = true;
 
@@ -1305,7 +1779,11 @@ namespace Retrievers
 
     uintptr_t GetBaseAddress()
     {
+#ifdef _WIN32
         return reinterpret_cast<uintptr_t>(GetModuleHandle(NULL));
+#else
+        return 0; // There is no game module when generating offline.
+#endif
     }
 
     uintptr_t GetOffset(void* pointer)
@@ -1318,51 +1796,193 @@ namespace Retrievers
             return (address - baseAddress);
         }
 
-        return NULL;
+        return 0;
     }
 
     uintptr_t FindPattern(const uint8_t* pattern, const std::string& mask)
     {
         if (pattern && !mask.empty())
         {
-            MODULEINFO miInfos;
-            ZeroMemory(&miInfos, sizeof(MODULEINFO));
+            return FindPatterns({ { pattern, mask } }, true)[0];
+        }
+
+        return 0;
+    }
+
+    uint64_t HashPattern(const Scanner::FPattern& pattern)
+    {
+        uint64_t hash = Utils::Hash(pattern.Mask, static_cast<uint64_t>(pattern.Section));
+        return Utils::Hash(std::string(reinterpret_cast<const char*>(pattern.Pattern), pattern.Mask.length()), hash);
+    }
 
-            HMODULE hModule = GetModuleHandle(NULL);
-            K32GetModuleInformation(GetCurrentProcess(), hModule, &miInfos, sizeof(MODULEINFO));
+    void LoadSignatureCache(const Scanner::FModuleKey& moduleKey, std::map<uint64_t, uintptr_t>& offsets)
+    {
+        offsets.clear();
 
-            uintptr_t start = reinterpret_cast<uintptr_t>(hModule);
-            uintptr_t end = (start + miInfos.SizeOfImage);
+        std::ifstream file(GConfig::GetOutputPath() / GConfig::GetGameNameShort() / "SignatureCache.txt");
+        Scanner::FModuleKey cachedKey;
 
-            size_t currentPos = 0;
-            size_t maskLength = (mask.length() - 1);
+        // Everything cached is thrown out if it was found in a different build of the executable.
+        if ((file >> cachedKey.TimeDateStamp >> cachedKey.SizeOfImage >> cachedKey.CheckSum) && (cachedKey == moduleKey))
+        {
+            uint64_t patternHash = 0;
+            uintptr_t offset = 0;
 
-            for (uintptr_t retAddress = start; retAddress < end; retAddress++)
+            while (file >> patternHash >> offset)
             {
-                if (*reinterpret_cast<uint8_t*>(retAddress) == pattern[currentPos] || mask[currentPos] == '?')
-                {
-                    if (currentPos == maskLength)
-                    {
-                        return (retAddress - maskLength);
-                    }
+                offsets[patternHash] = offset;
+            }
+        }
+    }
+
+    void SaveSignatureCache(const Scanner::FModuleKey& moduleKey, const std::map<uint64_t, uintptr_t>& offsets)
+    {
+        if (GConfig::HasOutputPath())
+        {
+            std::filesystem::path fullDirectory = (GConfig::GetOutputPath() / GConfig::GetGameNameShort());
+            std::filesystem::create_directory(GConfig::GetOutputPath());
+            std::filesystem::create_directory(fullDirectory);
+
+            TextBuffer buffer;
+            buffer << moduleKey.TimeDateStamp << " " << moduleKey.SizeOfImage << " " << moduleKey.CheckSum << "\n";
 
-                    currentPos++;
+            for (const auto& offsetPair : offsets)
+            {
+                buffer << offsetPair.first << " " << offsetPair.second << "\n";
+            }
+
+            std::ofstream file(fullDirectory / "SignatureCache.txt");
+            file << buffer;
+        }
+    }
+
+    const uint8_t* GetModuleImage(size_t& imageSize)
+    {
+        imageSize = 0;
+
+#ifdef _WIN32
+        MODULEINFO miInfos;
+        ZeroMemory(&miInfos, sizeof(MODULEINFO));
+
+        HMODULE hModule = GetModuleHandle(NULL);
+        K32GetModuleInformation(GetCurrentProcess(), hModule, &miInfos, sizeof(MODULEINFO));
+
+        imageSize = miInfos.SizeOfImage;
+        return reinterpret_cast<const uint8_t*>(hModule);
+#else
+        return nullptr; // There is no game module when generating offline.
+#endif
+    }
+
+    // Signatures that have resolve steps are found in code, and then followed to whatever they reference.
+    Scanner::FPattern CreatePattern(const Scanner::FSignature& signature, const uint8_t* pattern, const std::string& mask, Scanner::ESectionType sectionType)
+    {
+        if (!signature.IsEmpty())
+        {
+            return signature.ToPattern((signature.StepCount > 0) ? Scanner::ESectionType::Code : sectionType);
+        }
+
+        return { pattern, mask, sectionType };
+    }
+
+    uintptr_t ResolveSignature(uintptr_t address, const Scanner::FSignature& signature)
+    {
+        size_t imageSize = 0;
+        const uint8_t* image = GetModuleImage(imageSize);
+
+        if (address && !signature.IsEmpty() && (signature.StepCount > 0))
+        {
+            return Scanner::Resolve(image, imageSize, address, signature);
+        }
+
+        return address;
+    }
+
+    // Offsets from the start of the module are cached instead of addresses, so they still work if the module is loaded somewhere else next time.
+    // A cached offset is only used if the pattern is still there, anything that isn't is scanned for again along with patterns that weren't cached.
+    std::vector<uintptr_t> FindPatterns(const std::vector<Scanner::FPattern>& patterns, bool bUseCache)
+    {
+        std::vector<uintptr_t> addresses(patterns.size(), 0);
+        size_t imageSize = 0;
+        const uint8_t* image = GetModuleImage(imageSize);
+
+        if (!image || patterns.empty())
+        {
+            return addresses;
+        }
+
+        Scanner::FModuleKey moduleKey;
+        bool bHasKey = Scanner::GetModuleKey(image, imageSize, moduleKey);
+        std::map<uint64_t, uintptr_t> offsets;
+        std::vector<Scanner::FPattern> uncached;
+        std::vector<size_t> uncachedIndexes;
+
+        if (bHasKey)
+        {
+            LoadSignatureCache(moduleKey, offsets);
+        }
+
+        for (size_t i = 0; i < patterns.size(); i++)
+        {
+            auto offsetIt = offsets.find(HashPattern(patterns[i]));
+
+            if (bUseCache && (offsetIt != offsets.end()) && Scanner::Matches(image, imageSize, offsetIt->second, patterns[i]))
+            {
+                addresses[i] = reinterpret_cast<uintptr_t>(image + offsetIt->second);
+            }
+            else
+            {
+                uncached.push_back(patterns[i]);
+                uncachedIndexes.push_back(i);
+            }
+        }
+
+        if (!uncached.empty())
+        {
+            bool bStartedScheduler = !GScheduler::IsRunning(); // Globals are found before anything is generated, so the scheduler usually isn't running yet.
+
+            if (bStartedScheduler)
+            {
+                GScheduler::Start(Utils::GetThreadCount());
+            }
+
+            std::vector<const uint8_t*> results = Scanner::FindInImage(image, imageSize, true, uncached);
+
+            if (bStartedScheduler)
+            {
+                GScheduler::Stop();
+            }
+
+            for (size_t i = 0; i < results.size(); i++)
+            {
+                uint64_t patternHash = HashPattern(uncached[i]);
+
+                if (results[i])
+                {
+                    addresses[uncachedIndexes[i]] = reinterpret_cast<uintptr_t>(results[i]);
+                    offsets[patternHash] = static_cast<uintptr_t>(results[i] - image);
                 }
                 else
                 {
-                    retAddress -= currentPos;
-                    currentPos = 0;
+                    offsets.erase(patternHash);
                 }
             }
+
+            if (bHasKey)
+            {
+                SaveSignatureCache(moduleKey, offsets);
+            }
         }
 
-        return NULL;
+        return addresses;
     }
 }
 
 namespace ConstGenerator
 {
     static std::map<std::string, class UConst*> m_constNames;
+    static std::unordered_map<class UConst*, std::string> m_constObjects; // Reverse of "m_constNames", so naming the same const again always gives back its first name.
+    static std::mutex m_constMutex; // Packages are generated on multiple threads, any of which can name a const it comes across.
 
     void GenerateConstName(UnrealObject* unrealObj)
     {
@@ -1370,6 +1990,15 @@ namespace ConstGenerator
         {
             if (unrealObj->ValidName.find("Default__") == std::string::npos)
             {
+                std::lock_guard<std::mutex> constLock(m_constMutex);
+                auto objectIt = m_constObjects.find(static_cast<UConst*>(unrealObj->Object));
+
+                if (objectIt != m_constObjects.end())
+                {
+                    unrealObj->ValidName = objectIt->second;
+                    return;
+                }
+
                 std::string constName = unrealObj->ValidName;
 
                 if (unrealObj->Object->Name.GetInstance())
@@ -1400,6 +2029,7 @@ namespace ConstGenerator
 
                 unrealObj->ValidName = constName;
                 m_constNames[constName] = static_cast<UConst*>(unrealObj->Object);
+                m_constObjects[static_cast<UConst*>(unrealObj->Object)] = constName;
             }
             else
             {
@@ -1408,7 +2038,7 @@ namespace ConstGenerator
         }
     }
 
-    void GenerateConst(std::ofstream& stream, const UnrealObject& unrealObj)
+    void GenerateConst(TextBuffer& stream, const UnrealObject& unrealObj)
     {
         if (unrealObj.IsValid())
         {
@@ -1430,7 +2060,7 @@ namespace ConstGenerator
         }
     }
 
-    void ProcessConsts(std::ofstream& stream, class UObject* packageObj)
+    void ProcessConsts(TextBuffer& stream, class UObject* packageObj)
     {
         if (packageObj)
         {
@@ -1450,6 +2080,8 @@ namespace ConstGenerator
 namespace EnumGenerator
 {
     static std::map<std::string, class UEnum*> m_enumNames;
+    static std::unordered_map<class UEnum*, std::string> m_enumObjects; // Reverse of "m_enumNames", so naming the same enum again always gives back its first name.
+    static std::mutex m_enumMutex; // Packages are generated on multiple threads, any of which can name a enum it comes across.
 
     void GenerateEnumName(UnrealObject* unrealObj)
     {
@@ -1457,6 +2089,15 @@ namespace EnumGenerator
         {
             if (unrealObj->ValidName.find("Default__") == std::string::npos)
             {
+                std::lock_guard<std::mutex> enumLock(m_enumMutex);
+                auto objectIt = m_enumObjects.find(static_cast<UEnum*>(unrealObj->Object));
+
+                if (objectIt != m_enumObjects.end())
+                {
+                    unrealObj->ValidName = objectIt->second;
+                    return;
+                }
+
                 std::string enumName = unrealObj->ValidName;
 
                 if (unrealObj->Object->Name.GetInstance())
@@ -1487,6 +2128,7 @@ namespace EnumGenerator
 
                 unrealObj->ValidName = enumName;
                 m_enumNames[enumName] = static_cast<UEnum*>(unrealObj->Object);
+                m_enumObjects[static_cast<UEnum*>(unrealObj->Object)] = enumName;
             }
             else
             {
@@ -1495,7 +2137,7 @@ namespace EnumGenerator
         }
     }
 
-    void GenerateEnum(std::ofstream& file, const UnrealObject& unrealObj)
+    void GenerateEnum(TextBuffer& file, const UnrealObject& unrealObj)
     {
         if (unrealObj.IsValid())
         {
@@ -1503,8 +2145,9 @@ namespace EnumGenerator
             GLogger::LogObject("Enum: ", unrealObj);
 #endif
 
-            std::ostringstream enumStream;
-            std::ostringstream propertyStream;
+            TextBuffer enumStream;
+            TextBuffer propertyStream;
+            Printer::NumberBuffer numberBuffer;
             enumStream << "// " << unrealObj.FullName << "\n";
 
             if (GConfig::UsingEnumClasses())
@@ -1523,7 +2166,7 @@ namespace EnumGenerator
 
             for (int32_t i = 0; i < uEnum->Names.size(); i++)
             {
-                std::string propertyName = UnrealObject::CreateValidName(uEnum->Names[i].ToString());
+                std::string propertyName = UnrealObject::CreateValidName(std::string(uEnum->Names[i].ToStringView()));
                 size_t maxPos = propertyName.find("_MAX");
 
                 if (maxPos != std::string::npos)
@@ -1543,7 +2186,7 @@ namespace EnumGenerator
                 }
                 else
                 {
-                    propertyStream << propertyName << Printer::Decimal(enumValues[propertyName], EWidthTypes::Byte);
+                    propertyStream << propertyName << Printer::Decimal(numberBuffer, enumValues[propertyName], EWidthTypes::Byte);
                     enumValues[propertyName]++;
                 }
 
@@ -1561,11 +2204,11 @@ namespace EnumGenerator
             }
 
             enumStream << "};\n\n";
-            file << enumStream.str();
+            file << enumStream;
         }
     }
 
-    void ProcessEnums(std::ofstream& stream, class UObject* packageObj)
+    void ProcessEnums(TextBuffer& stream, class UObject* packageObj)
     {
         if (packageObj)
         {
@@ -1585,12 +2228,14 @@ namespace EnumGenerator
 namespace StructGenerator
 {
     static std::map<std::string, int32_t> m_generatedStructs;
+    static std::unordered_map<class UObject*, std::vector<UnrealObject>> m_plannedStructs; // Packages to the structs they generate in order, including structs from other packages they depend on.
 
-    void GenerateStructMembers(std::ofstream& structStream, EClassTypes structType)
+    void GenerateStructMembers(TextBuffer& structStream, EClassTypes structType)
     {
         if (structType != EClassTypes::Unknown)
         {
-            std::ostringstream propertyStream;
+            TextBuffer propertyStream;
+            Printer::NumberBuffer numberBuffer;
 
             size_t localSize = 0;
             size_t startOffset = 0;
@@ -1614,19 +2259,19 @@ namespace StructGenerator
 
                         if (missedOffset >= GConfig::GetGameAlignment())
                         {
-                            propertyStream << "\tuint8_t UnknownData" << Printer::Decimal(unknownDataIndex, EWidthTypes::Byte);
-                            propertyStream << "[" << Printer::Hex(missedOffset) << "];";
+                            propertyStream << "\tuint8_t UnknownData" << Printer::Decimal(numberBuffer, unknownDataIndex, EWidthTypes::Byte);
+                            propertyStream << "[" << Printer::Hex(numberBuffer, missedOffset) << "];";
 
-                            structStream << propertyStream.str() << "// " << Printer::Hex(lastOffset, EWidthTypes::Size);
-                            structStream << " (" << Printer::Hex(missedOffset, EWidthTypes::Size) << ") DYNAMIC FIELD PADDING\n";
+                            structStream << propertyStream.str() << "// " << Printer::Hex(numberBuffer, lastOffset, EWidthTypes::Size);
+                            structStream << " (" << Printer::Hex(numberBuffer, missedOffset, EWidthTypes::Size) << ") DYNAMIC FIELD PADDING\n";
                             Printer::Empty(propertyStream);
 
                             unknownDataIndex++;
                         }
                     }
 
-                    structStream << "\t" << memberPair.second->Label << " // " << Printer::Hex(memberPair.second->Offset, EWidthTypes::Size);
-                    structStream << " (" << Printer::Hex(memberPair.second->Size, EWidthTypes::Size) << ")\n";
+                    structStream << "\t" << memberPair.second->Label << " // " << Printer::Hex(numberBuffer, memberPair.second->Offset, EWidthTypes::Size);
+                    structStream << " (" << Printer::Hex(numberBuffer, memberPair.second->Size, EWidthTypes::Size) << ")\n";
                     lastOffset = (memberPair.second->Offset + memberPair.second->Size);
                 }
 
@@ -1636,11 +2281,11 @@ namespace StructGenerator
 
                     if (missedOffset >= GConfig::GetGameAlignment())
                     {
-                        propertyStream << "\tuint8_t UnknownData" << Printer::Decimal(unknownDataIndex, EWidthTypes::Byte);
-                        propertyStream << "[" << Printer::Hex(missedOffset) << "];";
+                        propertyStream << "\tuint8_t UnknownData" << Printer::Decimal(numberBuffer, unknownDataIndex, EWidthTypes::Byte);
+                        propertyStream << "[" << Printer::Hex(numberBuffer, missedOffset) << "];";
 
-                        structStream << propertyStream.str() << "// " << Printer::Hex(lastOffset, EWidthTypes::Size);
-                        structStream << " (" << Printer::Hex(missedOffset, EWidthTypes::Size) << ") DYNAMIC FIELD PADDING\n";
+                        structStream << propertyStream.str() << "// " << Printer::Hex(numberBuffer, lastOffset, EWidthTypes::Size);
+                        structStream << " (" << Printer::Hex(numberBuffer, missedOffset, EWidthTypes::Size) << ") DYNAMIC FIELD PADDING\n";
                     }
                 }
             }
@@ -1654,7 +2299,7 @@ namespace StructGenerator
         }
     }
 
-    void GenerateStruct(std::ofstream& file, const UnrealObject& unrealObj)
+    void GenerateStruct(TextBuffer& file, const UnrealObject& unrealObj)
     {
         if (unrealObj.IsValid())
         {
@@ -1670,9 +2315,10 @@ namespace StructGenerator
             GLogger::LogObject("ScriptStruct: ", unrealObj);
 #endif
 
-            std::ostringstream structStream;
-            std::ostringstream propertyStream;
-            std::ostringstream flagStream;
+            TextBuffer structStream;
+            TextBuffer propertyStream;
+            TextBuffer flagStream;
+            Printer::NumberBuffer numberBuffer;
 
             structStream << "// " << unrealObj.FullName << "\n";
 
@@ -1695,9 +2341,9 @@ namespace StructGenerator
                     std::string fieldNameCPP = UnrealObject::CreateValidName(superField->GetNameCPP());
                     uint64_t fieldStructCount = GCache::CountObject<UScriptStruct>(fieldName);
 
-                    structStream << "// " << Printer::Hex(size, EWidthTypes::Size);
-                    structStream << " (" << Printer::Hex(superField->PropertySize, EWidthTypes::Size);
-                    structStream << " - " << Printer::Hex(scriptStruct->PropertySize, EWidthTypes::Size);
+                    structStream << "// " << Printer::Hex(numberBuffer, size, EWidthTypes::Size);
+                    structStream << " (" << Printer::Hex(numberBuffer, superField->PropertySize, EWidthTypes::Size);
+                    structStream << " - " << Printer::Hex(numberBuffer, scriptStruct->PropertySize, EWidthTypes::Size);
                     structStream << ")\n";
 
                     if (structCount > 1)
@@ -1721,7 +2367,7 @@ namespace StructGenerator
                 else
                 {
                     size = scriptStruct->PropertySize;
-                    structStream << "// " << Printer::Hex(size, EWidthTypes::Size) << "\n";
+                    structStream << "// " << Printer::Hex(numberBuffer, size, EWidthTypes::Size) << "\n";
 
                     if (structCount > 1)
                     {
@@ -1738,7 +2384,7 @@ namespace StructGenerator
 
                 for (UProperty* uProperty = static_cast<UProperty*>(scriptStruct->Children); uProperty; uProperty = static_cast<UProperty*>(uProperty->Next))
                 {
-                    if (uProperty && (uProperty->ElementSize > 0) && !uProperty->IsA<UScriptStruct>())
+                    if (uProperty && (uProperty->ElementSize > 0) && !GCache::IsA(uProperty, ANCESTRY_ScriptStruct))
                     {
                         UnrealProperty unrealProp(uProperty);
 
@@ -1763,16 +2409,17 @@ namespace StructGenerator
 
                             if (missedOffset >= GConfig::GetGameAlignment())
                             {
-                                std::string missedStr = Printer::Hex(missedOffset);
-                                propertyStream << "UnknownData" << Printer::Decimal(unknownDataIndex, EWidthTypes::Byte);
+                                Printer::NumberBuffer missedBuffer;
+                                std::string_view missedStr = Printer::Hex(missedBuffer, missedOffset);
+                                propertyStream << "UnknownData" << Printer::Decimal(numberBuffer, unknownDataIndex, EWidthTypes::Byte);
                                 propertyStream << "[" << missedStr << "];";
 
                                 Printer::FillLeft(structStream, ' ', (GConfig::GetStructSpacing() + UNKNOWN_DATA_SPACING));
                                 structStream << "\tuint8_t";
                                 Printer::FillLeft(structStream, ' ', ((GConfig::GetStructSpacing() - missedStr.length()) + UNKNOWN_DATA_SPACING));
 
-                                structStream << propertyStream.str() << "// " << Printer::Hex(lastOffset, EWidthTypes::Size);
-                                structStream << " (" << Printer::Hex(missedOffset, EWidthTypes::Size) << ") MISSED OFFSET\n";
+                                structStream << propertyStream.str() << "// " << Printer::Hex(numberBuffer, lastOffset, EWidthTypes::Size);
+                                structStream << " (" << Printer::Hex(numberBuffer, missedOffset, EWidthTypes::Size) << ") MISSED OFFSET\n";
                                 Printer::Empty(propertyStream);
 
                                 unknownDataIndex++;
@@ -1788,7 +2435,7 @@ namespace StructGenerator
                         }
                         else
                         {
-                            propertyStream << unrealProp.ValidName << Printer::Decimal(propertyNameMap.at(unrealProp.ValidName), EWidthTypes::Byte);
+                            propertyStream << unrealProp.ValidName << Printer::Decimal(numberBuffer, propertyNameMap.at(unrealProp.ValidName), EWidthTypes::Byte);
                             propertyNameMap[unrealProp.ValidName]++;
                         }
 
@@ -1839,9 +2486,9 @@ namespace StructGenerator
                                 Printer::FillRight(structStream, ' ', (GConfig::GetStructSpacing() - propSpacing));
                             }
 
-                            structStream << "// " << Printer::Hex(unrealProp.Property->Offset, EWidthTypes::Size);
-                            structStream << " (" << Printer::Hex((unrealProp.Property->ElementSize * unrealProp.Property->ArrayDim), EWidthTypes::Size) << ")";
-                            structStream << " [" << Printer::Hex(unrealProp.Property->PropertyFlags, EWidthTypes::PropertyFlags) << "] ";
+                            structStream << "// " << Printer::Hex(numberBuffer, unrealProp.Property->Offset, EWidthTypes::Size);
+                            structStream << " (" << Printer::Hex(numberBuffer, (unrealProp.Property->ElementSize * unrealProp.Property->ArrayDim), EWidthTypes::Size) << ")";
+                            structStream << " [" << Printer::Hex(numberBuffer, unrealProp.Property->PropertyFlags, EWidthTypes::PropertyFlags) << "] ";
                             structStream << flagStream.str() << "\n";
 
                             structStream << "\t";
@@ -1864,9 +2511,9 @@ namespace StructGenerator
                                 Printer::FillRight(structStream, ' ', (GConfig::GetStructSpacing() - interfaceSpacing));
                             }
 
-                            structStream << "// " << Printer::Hex(unrealProp.Property->Offset, EWidthTypes::Size);
-                            structStream << " (" << Printer::Hex((unrealProp.Property->ElementSize * unrealProp.Property->ArrayDim), EWidthTypes::Size) << ")";
-                            structStream << " [" << Printer::Hex(unrealProp.Property->PropertyFlags, EWidthTypes::PropertyFlags) << "] ";
+                            structStream << "// " << Printer::Hex(numberBuffer, unrealProp.Property->Offset, EWidthTypes::Size);
+                            structStream << " (" << Printer::Hex(numberBuffer, (unrealProp.Property->ElementSize * unrealProp.Property->ArrayDim), EWidthTypes::Size) << ")";
+                            structStream << " [" << Printer::Hex(numberBuffer, unrealProp.Property->PropertyFlags, EWidthTypes::PropertyFlags) << "] ";
                             Printer::FillLeft(structStream, ' ', static_cast<size_t>(EWidthTypes::FieldWidth));
                         }
                         else
@@ -1882,13 +2529,13 @@ namespace StructGenerator
                                 Printer::FillRight(structStream, ' ', (GConfig::GetStructSpacing() - propSpacing));
                             }
 
-                            structStream << "// " << Printer::Hex(unrealProp.Property->Offset, EWidthTypes::Size);
-                            structStream << " (" << Printer::Hex((unrealProp.Property->ElementSize * unrealProp.Property->ArrayDim), EWidthTypes::Size) << ")";
-                            structStream << " [" << Printer::Hex(unrealProp.Property->PropertyFlags, EWidthTypes::PropertyFlags) << "] ";
+                            structStream << "// " << Printer::Hex(numberBuffer, unrealProp.Property->Offset, EWidthTypes::Size);
+                            structStream << " (" << Printer::Hex(numberBuffer, (unrealProp.Property->ElementSize * unrealProp.Property->ArrayDim), EWidthTypes::Size) << ")";
+                            structStream << " [" << Printer::Hex(numberBuffer, unrealProp.Property->PropertyFlags, EWidthTypes::PropertyFlags) << "] ";
 
                             if (unrealProp.Type == EPropertyTypes::Bool)
                             {
-                                structStream << "[" << Printer::Hex(static_cast<UBoolProperty*>(unrealProp.Property)->BitMask, EWidthTypes::BitMask) << "] ";
+                                structStream << "[" << Printer::Hex(numberBuffer, static_cast<UBoolProperty*>(unrealProp.Property)->BitMask, EWidthTypes::BitMask) << "] ";
                             }
                             else
                             {
@@ -1900,20 +2547,21 @@ namespace StructGenerator
 
                         if (offsetError > 0)
                         {
-                            std::string missedStr = Printer::Hex(offsetError);
-                            propertyStream << "UnknownData" << Printer::Decimal(unknownDataIndex, EWidthTypes::Byte);
+                            Printer::NumberBuffer missedBuffer;
+                            std::string_view missedStr = Printer::Hex(missedBuffer, offsetError);
+                            propertyStream << "UnknownData" << Printer::Decimal(numberBuffer, unknownDataIndex, EWidthTypes::Byte);
                             propertyStream << "[" << missedStr << "];";
 
                             Printer::FillLeft(structStream, ' ', (GConfig::GetStructSpacing() + UNKNOWN_DATA_SPACING));
                             structStream << "\tuint8_t";
                             Printer::FillLeft(structStream, ' ', ((GConfig::GetStructSpacing() - missedStr.length()) + UNKNOWN_DATA_SPACING));
 
-                            structStream << propertyStream.str() << "// " << Printer::Hex(unrealProp.Property->Offset + offsetError, EWidthTypes::Size);
+                            structStream << propertyStream.str() << "// " << Printer::Hex(numberBuffer, unrealProp.Property->Offset + offsetError, EWidthTypes::Size);
                             Printer::Empty(propertyStream);
 
-                            structStream << " (" << Printer::Hex(offsetError, EWidthTypes::Size) << ") FIX WRONG SIZE OF PREVIOUS PROPERTY";
-                            structStream << " [Original: " << Printer::Hex((unrealProp.Property->ElementSize * unrealProp.Property->ArrayDim), EWidthTypes::Size);
-                            structStream << ", Missing: " << Printer::Hex(offsetError, EWidthTypes::Size) << "]\n";
+                            structStream << " (" << Printer::Hex(numberBuffer, offsetError, EWidthTypes::Size) << ") FIX WRONG SIZE OF PREVIOUS PROPERTY";
+                            structStream << " [Original: " << Printer::Hex(numberBuffer, (unrealProp.Property->ElementSize * unrealProp.Property->ArrayDim), EWidthTypes::Size);
+                            structStream << ", Missing: " << Printer::Hex(numberBuffer, offsetError, EWidthTypes::Size) << "]\n";
 
                             unknownDataIndex++;
                         }
@@ -1925,16 +2573,17 @@ namespace StructGenerator
                     }
                     else if (unrealProp.Property)
                     {
-                        std::string missedStr = Printer::Hex(unrealProp.Property->ElementSize * unrealProp.Property->ArrayDim);
-                        propertyStream << "UnknownData" << Printer::Decimal(unknownDataIndex, EWidthTypes::Byte);
+                        Printer::NumberBuffer missedBuffer;
+                        std::string_view missedStr = Printer::Hex(missedBuffer, unrealProp.Property->ElementSize * unrealProp.Property->ArrayDim);
+                        propertyStream << "UnknownData" << Printer::Decimal(numberBuffer, unknownDataIndex, EWidthTypes::Byte);
                         propertyStream << "[" << missedStr << "];";
 
                         Printer::FillLeft(structStream, ' ', (GConfig::GetStructSpacing() + UNKNOWN_DATA_SPACING));
                         structStream << "\tuint8_t";
                         Printer::FillLeft(structStream, ' ', ((GConfig::GetStructSpacing() - missedStr.length()) + UNKNOWN_DATA_SPACING));
 
-                        structStream << propertyStream.str() << "// " << Printer::Hex(unrealProp.Property->Offset, EWidthTypes::Size);
-                        structStream << " (" << Printer::Hex((unrealProp.Property->ElementSize * unrealProp.Property->ArrayDim), EWidthTypes::Size);
+                        structStream << propertyStream.str() << "// " << Printer::Hex(numberBuffer, unrealProp.Property->Offset, EWidthTypes::Size);
+                        structStream << " (" << Printer::Hex(numberBuffer, (unrealProp.Property->ElementSize * unrealProp.Property->ArrayDim), EWidthTypes::Size);
                         structStream << ") UNKNOWN PROPERTY: " << unrealProp.Property->GetFullName() << "\n";
                         Printer::Empty(propertyStream);
 
@@ -1949,16 +2598,17 @@ namespace StructGenerator
 
                     if (missedOffset >= GConfig::GetGameAlignment())
                     {
-                        std::string missedStr = Printer::Hex(missedOffset);
-                        propertyStream << "UnknownData" << Printer::Decimal(unknownDataIndex, EWidthTypes::Byte);
+                        Printer::NumberBuffer missedBuffer;
+                        std::string_view missedStr = Printer::Hex(missedBuffer, missedOffset);
+                        propertyStream << "UnknownData" << Printer::Decimal(numberBuffer, unknownDataIndex, EWidthTypes::Byte);
                         propertyStream << "[" << missedStr << "];";
 
                         Printer::FillLeft(structStream, ' ', (GConfig::GetStructSpacing() + UNKNOWN_DATA_SPACING));
                         structStream << "\tuint8_t";
                         Printer::FillLeft(structStream, ' ', ((GConfig::GetStructSpacing() - missedStr.length()) + UNKNOWN_DATA_SPACING));
 
-                        structStream << propertyStream.str() << "// " << Printer::Hex(lastOffset, EWidthTypes::Size);
-                        structStream << " (" << Printer::Hex(missedOffset, EWidthTypes::Size) << ") MISSED OFFSET\n";
+                        structStream << propertyStream.str() << "// " << Printer::Hex(numberBuffer, lastOffset, EWidthTypes::Size);
+                        structStream << " (" << Printer::Hex(numberBuffer, missedOffset, EWidthTypes::Size) << ") MISSED OFFSET\n";
                         Printer::Empty(propertyStream);
                     }
 
@@ -1978,15 +2628,16 @@ namespace StructGenerator
                     if ((lastOffset < actualSize) && (actualSize > scriptStruct->PropertySize))
                     {
                         int32_t padding = (actualSize - lastOffset);
-                        std::string missedStr = Printer::Hex(padding);
+                        Printer::NumberBuffer missedBuffer;
+                        std::string_view missedStr = Printer::Hex(missedBuffer, padding);
                         propertyStream << "MinStructAlignment" << "[" << missedStr << "];";
 
                         Printer::FillLeft(structStream, ' ', (GConfig::GetStructSpacing() + UNKNOWN_DATA_SPACING));
                         structStream << "\tuint8_t";
                         Printer::FillLeft(structStream, ' ', ((GConfig::GetStructSpacing() - missedStr.length()) + UNKNOWN_DATA_SPACING));
 
-                        structStream << propertyStream.str() << "// " << Printer::Hex(lastOffset, EWidthTypes::Size);
-                        structStream << " (" << Printer::Hex(padding, EWidthTypes::Size) << ") ADDED PADDING\n";
+                        structStream << propertyStream.str() << "// " << Printer::Hex(numberBuffer, lastOffset, EWidthTypes::Size);
+                        structStream << " (" << Printer::Hex(numberBuffer, padding, EWidthTypes::Size) << ") ADDED PADDING\n";
 
 #ifndef NO_LOGGING
                         GLogger::LogStructPadding(scriptStruct, padding);
@@ -2007,7 +2658,8 @@ namespace StructGenerator
         }
     }
 
-    void GenerateStructPre(std::ofstream& stream, const UnrealObject& unrealObj)
+    // Decides which package generates each struct before any are generated, so packages can be generated at the same time without sharing "m_generatedStructs".
+    void PlanStructPre(std::vector<UnrealObject>& plan, const UnrealObject& unrealObj)
     {
         if (unrealObj.IsValid() && !m_generatedStructs.contains(unrealObj.FullName))
         {
@@ -2023,9 +2675,9 @@ namespace StructGenerator
             {
                 UScriptStruct* superStruct = static_cast<UScriptStruct*>(scriptStruct->SuperField);
 
-                if (!m_generatedStructs.contains(superStruct->GetFullName()))
+                if (!m_generatedStructs.contains(GCache::GetFullName(superStruct)))
                 {
-                    GenerateStructPre(stream, superStruct);
+                    PlanStructPre(plan, superStruct);
                 }
             }
 
@@ -2039,9 +2691,9 @@ namespace StructGenerator
                     {
                         UScriptStruct* propertyStruct = static_cast<UScriptStruct*>(static_cast<UStructProperty*>(structProp.Property)->Struct);
 
-                        if (propertyStruct && (propertyStruct != scriptStruct) && !m_generatedStructs.contains(propertyStruct->GetFullName()))
+                        if (propertyStruct && (propertyStruct != scriptStruct) && !m_generatedStructs.contains(GCache::GetFullName(propertyStruct)))
                         {
-                            GenerateStructPre(stream, propertyStruct);
+                            PlanStructPre(plan, propertyStruct);
                         }
                     }
                     else if (structProp.Type == EPropertyTypes::TArray)
@@ -2052,46 +2704,68 @@ namespace StructGenerator
                         {
                             UnrealProperty innerProp(static_cast<UArrayProperty*>(structProp.Property)->Inner);
 
-                            if (innerProp.IsValid() && (innerProp.Type == EPropertyTypes::FStruct) && !m_generatedStructs.contains(innerProp.Property->GetFullName()))
+                            if (innerProp.IsValid() && (innerProp.Type == EPropertyTypes::FStruct) && !m_generatedStructs.contains(GCache::GetFullName(innerProp.Property)))
                             {
-                                GenerateStructPre(stream, propertyStruct);
+                                PlanStructPre(plan, propertyStruct);
                             }
                         }
                     }
                 }
             }
 
-            GenerateStruct(stream, unrealObj);
+            plan.push_back(unrealObj);
             m_generatedStructs[unrealObj.FullName] = unrealObj.Object->ObjectInternalInteger;
         }
     }
 
-    void ProcessStructs(std::ofstream& stream, class UObject* packageObj)
+    void PlanStructs(class UObject* packageObj)
     {
         if (packageObj)
         {
             std::vector<UnrealObject>* objCache = GCache::GetCache(packageObj, EClassTypes::UStruct);
+            std::vector<UnrealObject>& plan = m_plannedStructs[packageObj];
 
             if (objCache)
             {
                 for (const UnrealObject& unrealObj : *objCache)
                 {
-                    GenerateStructPre(stream, unrealObj);
+                    PlanStructPre(plan, unrealObj);
                 }
             }
         }
     }
+
+    const std::vector<UnrealObject>* GetPlan(class UObject* packageObj)
+    {
+        auto planIt = m_plannedStructs.find(packageObj);
+        return ((planIt != m_plannedStructs.end()) ? &planIt->second : nullptr);
+    }
+
+    void ProcessStructs(TextBuffer& stream, class UObject* packageObj)
+    {
+        auto planIt = m_plannedStructs.find(packageObj);
+
+        if (planIt != m_plannedStructs.end())
+        {
+            for (const UnrealObject& unrealObj : planIt->second)
+            {
+                GenerateStruct(stream, unrealObj);
+            }
+        }
+    }
 }
 
 namespace ClassGenerator
 {
     static std::map<std::string, int32_t> m_generatedClasses;
+    static std::unordered_map<class UObject*, std::vector<UnrealObject>> m_plannedClasses; // Packages to their classes in order, super classes always come before the classes that inherit them.
 
-    void GenerateClassMembers(std::ostringstream& classStream, class UClass* uClass, EClassTypes classType)
+    void GenerateClassMembers(TextBuffer& classStream, class UClass* uClass, EClassTypes classType)
     {
         if (uClass && (classType != EClassTypes::Unknown))
         {
-            std::ostringstream propertyStream;
+            TextBuffer propertyStream;
+            Printer::NumberBuffer numberBuffer;
 
             size_t localSize = 0;
             size_t startOffset = 0;
@@ -2117,19 +2791,19 @@ namespace ClassGenerator
 
                             if (missedOffset >= GConfig::GetGameAlignment())
                             {
-                                propertyStream << "\tuint8_t UnknownData" << Printer::Decimal(unknownDataIndex, EWidthTypes::Byte);
-                                propertyStream << "[" << Printer::Hex(missedOffset) << "];";
+                                propertyStream << "\tuint8_t UnknownData" << Printer::Decimal(numberBuffer, unknownDataIndex, EWidthTypes::Byte);
+                                propertyStream << "[" << Printer::Hex(numberBuffer, missedOffset) << "];";
 
-                                classStream << propertyStream.str() << "// " << Printer::Hex(lastOffset, EWidthTypes::Size);
-                                classStream << " (" << Printer::Hex(missedOffset, EWidthTypes::Size) << ") DYNAMIC FIELD PADDING\n";
+                                classStream << propertyStream.str() << "// " << Printer::Hex(numberBuffer, lastOffset, EWidthTypes::Size);
+                                classStream << " (" << Printer::Hex(numberBuffer, missedOffset, EWidthTypes::Size) << ") DYNAMIC FIELD PADDING\n";
                                 Printer::Empty(propertyStream);
 
                                 unknownDataIndex++;
                             }
                         }
 
-                        classStream << "\t" << memberPair.second->Label << " // " << Printer::Hex(memberPair.second->Offset, EWidthTypes::Size);
-                        classStream << " (" << Printer::Hex(memberPair.second->Size, EWidthTypes::Size) << ")\n";
+                        classStream << "\t" << memberPair.second->Label << " // " << Printer::Hex(numberBuffer, memberPair.second->Offset, EWidthTypes::Size);
+                        classStream << " (" << Printer::Hex(numberBuffer, memberPair.second->Size, EWidthTypes::Size) << ")\n";
 
                         lastOffset = (memberPair.second->Offset + memberPair.second->Size);
                     }
@@ -2140,11 +2814,11 @@ namespace ClassGenerator
 
                         if (missedOffset >= GConfig::GetGameAlignment())
                         {
-                            propertyStream << "\tuint8_t UnknownData" << Printer::Decimal(unknownDataIndex, EWidthTypes::Byte);
-                            propertyStream << "[" << Printer::Hex(missedOffset) << "];";
+                            propertyStream << "\tuint8_t UnknownData" << Printer::Decimal(numberBuffer, unknownDataIndex, EWidthTypes::Byte);
+                            propertyStream << "[" << Printer::Hex(numberBuffer, missedOffset) << "];";
 
-                            classStream << propertyStream.str() << "// " << Printer::Hex(lastOffset, EWidthTypes::Size);
-                            classStream << " (" << Printer::Hex(missedOffset, EWidthTypes::Size) << ") DYNAMIC FIELD PADDING\n";
+                            classStream << propertyStream.str() << "// " << Printer::Hex(numberBuffer, lastOffset, EWidthTypes::Size);
+                            classStream << " (" << Printer::Hex(numberBuffer, missedOffset, EWidthTypes::Size) << ") DYNAMIC FIELD PADDING\n";
                         }
                     }
                 }
@@ -2166,7 +2840,7 @@ namespace ClassGenerator
         }
     }
 
-    void GenerateClass(std::ofstream& file, const UnrealObject& unrealObj)
+    void GenerateClass(TextBuffer& file, const UnrealObject& unrealObj)
     {
         if (unrealObj.IsValid())
         {
@@ -2183,9 +2857,10 @@ namespace ClassGenerator
             GLogger::LogObject("Class: ", unrealObj);
 #endif
 
-            std::ostringstream classStream;
-            std::ostringstream propertyStream;
-            std::ostringstream flagStream;
+            TextBuffer classStream;
+            TextBuffer propertyStream;
+            TextBuffer flagStream;
+            Printer::NumberBuffer numberBuffer;
 
             size_t size = 0;
             size_t lastOffset = 0;
@@ -2201,10 +2876,10 @@ namespace ClassGenerator
                 {
                     if (uProperty
                         && (uProperty->ElementSize > 0)
-                        && !uProperty->IsA<UFunction>()
-                        && !uProperty->IsA<UConst>()
-                        && !uProperty->IsA<UEnum>()
-                        && !uProperty->IsA<UScriptStruct>()
+                        && !GCache::IsA(uProperty, ANCESTRY_Function)
+                        && !GCache::IsA(uProperty, ANCESTRY_Const)
+                        && !GCache::IsA(uProperty, ANCESTRY_Enum)
+                        && !GCache::IsA(uProperty, ANCESTRY_ScriptStruct)
                         && (!uSuperClass || (uSuperClass && (uSuperClass != uClass) && (uProperty->Offset >= uSuperClass->PropertySize))))
                     {
                         UnrealProperty unrealProp(uProperty);
@@ -2223,16 +2898,16 @@ namespace ClassGenerator
                     size = (uClass->PropertySize - uSuperClass->PropertySize);
                     lastOffset = uSuperClass->PropertySize;
 
-                    classStream << "// " << Printer::Hex(size, EWidthTypes::Size);
-                    classStream << " (" << Printer::Hex(uSuperClass->PropertySize, EWidthTypes::Size);
-                    classStream << " - " << Printer::Hex(uClass->PropertySize, EWidthTypes::Size);
+                    classStream << "// " << Printer::Hex(numberBuffer, size, EWidthTypes::Size);
+                    classStream << " (" << Printer::Hex(numberBuffer, uSuperClass->PropertySize, EWidthTypes::Size);
+                    classStream << " - " << Printer::Hex(numberBuffer, uClass->PropertySize, EWidthTypes::Size);
                     classStream << ")\n" << "class " << classNameCPP << " : public " << UnrealObject::CreateValidName(uSuperClass->GetNameCPP());
                 }
                 else
                 {
                     size = uClass->PropertySize;
 
-                    classStream << "// " << Printer::Hex(size, EWidthTypes::Size) << "\n";
+                    classStream << "// " << Printer::Hex(numberBuffer, size, EWidthTypes::Size) << "\n";
                     classStream << "class " << classNameCPP;
                 }
 
@@ -2276,16 +2951,17 @@ namespace ClassGenerator
 
                                 if (missedOffset >= GConfig::GetGameAlignment())
                                 {
-                                    std::string missedStr = Printer::Hex(missedOffset);
-                                    propertyStream << "UnknownData" << Printer::Decimal(unknownDataIndex, EWidthTypes::Byte);
+                                    Printer::NumberBuffer missedBuffer;
+                                    std::string_view missedStr = Printer::Hex(missedBuffer, missedOffset);
+                                    propertyStream << "UnknownData" << Printer::Decimal(numberBuffer, unknownDataIndex, EWidthTypes::Byte);
                                     propertyStream << "[" << missedStr << "];";
 
                                     Printer::FillLeft(classStream, ' ', (GConfig::GetClassSpacing() + UNKNOWN_DATA_SPACING));
                                     classStream << "\tuint8_t";
                                     Printer::FillLeft(classStream, ' ', ((GConfig::GetClassSpacing() - missedStr.length()) + UNKNOWN_DATA_SPACING));
 
-                                    classStream << propertyStream.str() << "// " << Printer::Hex(lastOffset, EWidthTypes::Size);
-                                    classStream << " (" << Printer::Hex(missedOffset, EWidthTypes::Size) << ") MISSED OFFSET\n";
+                                    classStream << propertyStream.str() << "// " << Printer::Hex(numberBuffer, lastOffset, EWidthTypes::Size);
+                                    classStream << " (" << Printer::Hex(numberBuffer, missedOffset, EWidthTypes::Size) << ") MISSED OFFSET\n";
                                     Printer::Empty(propertyStream);
 
                                     unknownDataIndex++;
@@ -2301,7 +2977,7 @@ namespace ClassGenerator
                             }
                             else
                             {
-                                propertyStream << unrealProp.ValidName << Printer::Decimal(propertyNameMap.at(unrealProp.ValidName), EWidthTypes::Byte);
+                                propertyStream << unrealProp.ValidName << Printer::Decimal(numberBuffer, propertyNameMap.at(unrealProp.ValidName), EWidthTypes::Byte);
                                 propertyNameMap[unrealProp.ValidName]++;
                             }
 
@@ -2353,9 +3029,9 @@ namespace ClassGenerator
                                     Printer::FillRight(classStream, ' ', (GConfig::GetClassSpacing() - propSpacing));
                                 }
 
-                                classStream << "// " << Printer::Hex(unrealProp.Property->Offset, EWidthTypes::Size);
-                                classStream << " (" << Printer::Hex(((unrealProp.Property->ElementSize * unrealProp.Property->ArrayDim) - interfaceSize), EWidthTypes::Size) << ")";
-                                classStream << " [" << Printer::Hex(unrealProp.Property->PropertyFlags, EWidthTypes::PropertyFlags) << "] ";
+                                classStream << "// " << Printer::Hex(numberBuffer, unrealProp.Property->Offset, EWidthTypes::Size);
+                                classStream << " (" << Printer::Hex(numberBuffer, ((unrealProp.Property->ElementSize * unrealProp.Property->ArrayDim) - interfaceSize), EWidthTypes::Size) << ")";
+                                classStream << " [" << Printer::Hex(numberBuffer, unrealProp.Property->PropertyFlags, EWidthTypes::PropertyFlags) << "] ";
                                 classStream << flagStream.str() << "\n";
 
                                 classStream << "\t";
@@ -2379,9 +3055,9 @@ namespace ClassGenerator
                                     Printer::FillRight(classStream, ' ', (GConfig::GetClassSpacing() - interfaceSpacing));
                                 }
 
-                                classStream << "// " << Printer::Hex(unrealProp.Property->Offset + interfaceSize, EWidthTypes::Size);
-                                classStream << " (" << Printer::Hex(((unrealProp.Property->ElementSize * unrealProp.Property->ArrayDim) - interfaceSize), EWidthTypes::Size) << ")";
-                                classStream << " [" << Printer::Hex(unrealProp.Property->PropertyFlags, EWidthTypes::PropertyFlags) << "] ";
+                                classStream << "// " << Printer::Hex(numberBuffer, unrealProp.Property->Offset + interfaceSize, EWidthTypes::Size);
+                                classStream << " (" << Printer::Hex(numberBuffer, ((unrealProp.Property->ElementSize * unrealProp.Property->ArrayDim) - interfaceSize), EWidthTypes::Size) << ")";
+                                classStream << " [" << Printer::Hex(numberBuffer, unrealProp.Property->PropertyFlags, EWidthTypes::PropertyFlags) << "] ";
                                 Printer::FillLeft(classStream, ' ', static_cast<size_t>(EWidthTypes::FieldWidth));
                             }
                             else
@@ -2397,13 +3073,13 @@ namespace ClassGenerator
                                     Printer::FillRight(classStream, ' ', (GConfig::GetClassSpacing() - propSpacing));
                                 }
 
-                                classStream << "// " << Printer::Hex(unrealProp.Property->Offset, EWidthTypes::Size);
-                                classStream << " (" << Printer::Hex((unrealProp.Property->ElementSize * unrealProp.Property->ArrayDim), EWidthTypes::Size) << ")";
-                                classStream << " [" << Printer::Hex(unrealProp.Property->PropertyFlags, EWidthTypes::PropertyFlags) << "] ";
+                                classStream << "// " << Printer::Hex(numberBuffer, unrealProp.Property->Offset, EWidthTypes::Size);
+                                classStream << " (" << Printer::Hex(numberBuffer, (unrealProp.Property->ElementSize * unrealProp.Property->ArrayDim), EWidthTypes::Size) << ")";
+                                classStream << " [" << Printer::Hex(numberBuffer, unrealProp.Property->PropertyFlags, EWidthTypes::PropertyFlags) << "] ";
 
                                 if (unrealProp.Type == EPropertyTypes::Bool)
                                 {
-                                    classStream << "[" << Printer::Hex(static_cast<UBoolProperty*>(unrealProp.Property)->BitMask, EWidthTypes::BitMask) << "] ";
+                                    classStream << "[" << Printer::Hex(numberBuffer, static_cast<UBoolProperty*>(unrealProp.Property)->BitMask, EWidthTypes::BitMask) << "] ";
                                 }
                                 else
                                 {
@@ -2415,18 +3091,19 @@ namespace ClassGenerator
 
                             if (offsetError > 0)
                             {
-                                std::string missedStr = Printer::Hex(offsetError);
-                                propertyStream << "_UnknownData" << Printer::Decimal(unknownDataIndex, EWidthTypes::Byte);
+                                Printer::NumberBuffer missedBuffer;
+                                std::string_view missedStr = Printer::Hex(missedBuffer, offsetError);
+                                propertyStream << "_UnknownData" << Printer::Decimal(numberBuffer, unknownDataIndex, EWidthTypes::Byte);
                                 propertyStream << "[" << missedStr << "];";
 
                                 Printer::FillLeft(classStream, ' ', (GConfig::GetClassSpacing() + UNKNOWN_DATA_SPACING));
                                 classStream << "\tuint8_t";
                                 Printer::FillLeft(classStream, ' ', ((GConfig::GetClassSpacing() - missedStr.length()) + UNKNOWN_DATA_SPACING));
 
-                                classStream << propertyStream.str() << "// " << Printer::Hex((unrealProp.Property->Offset + offsetError), EWidthTypes::Size);
-                                classStream << " (" << Printer::Hex(offsetError, EWidthTypes::Size) << ") FIX WRONG SIZE OF PREVIOUS PROPERTY ";
-                                classStream << " [Original:" << Printer::Hex((unrealProp.Property->ElementSize * unrealProp.Property->ArrayDim), EWidthTypes::Size);
-                                classStream << ", Missing: " << Printer::Hex(offsetError, EWidthTypes::Size) << "]\n";
+                                classStream << propertyStream.str() << "// " << Printer::Hex(numberBuffer, (unrealProp.Property->Offset + offsetError), EWidthTypes::Size);
+                                classStream << " (" << Printer::Hex(numberBuffer, offsetError, EWidthTypes::Size) << ") FIX WRONG SIZE OF PREVIOUS PROPERTY ";
+                                classStream << " [Original:" << Printer::Hex(numberBuffer, (unrealProp.Property->ElementSize * unrealProp.Property->ArrayDim), EWidthTypes::Size);
+                                classStream << ", Missing: " << Printer::Hex(numberBuffer, offsetError, EWidthTypes::Size) << "]\n";
                                 Printer::Empty(propertyStream);
 
                                 unknownDataIndex++;
@@ -2439,16 +3116,17 @@ namespace ClassGenerator
                         }
                         else if (unrealProp.Property)
                         {
-                            std::string missedStr = Printer::Hex(unrealProp.Property->ElementSize * unrealProp.Property->ArrayDim);
-                            propertyStream << "UnknownData" << Printer::Decimal(unknownDataIndex, EWidthTypes::Byte);
+                            Printer::NumberBuffer missedBuffer;
+                            std::string_view missedStr = Printer::Hex(missedBuffer, unrealProp.Property->ElementSize * unrealProp.Property->ArrayDim);
+                            propertyStream << "UnknownData" << Printer::Decimal(numberBuffer, unknownDataIndex, EWidthTypes::Byte);
                             propertyStream << "[" << missedStr << "];";
 
                             Printer::FillLeft(classStream, ' ', GConfig::GetClassSpacing());
                             classStream << "\tuint8_t";
                             Printer::FillLeft(classStream, ' ', ((GConfig::GetClassSpacing() - missedStr.length()) + UNKNOWN_DATA_SPACING));
 
-                            classStream << propertyStream.str() << "// " << Printer::Hex(unrealProp.Property->Offset, EWidthTypes::Size);
-                            classStream << " (" << Printer::Hex((unrealProp.Property->ElementSize * unrealProp.Property->ArrayDim), EWidthTypes::Size);
+                            classStream << propertyStream.str() << "// " << Printer::Hex(numberBuffer, unrealProp.Property->Offset, EWidthTypes::Size);
+                            classStream << " (" << Printer::Hex(numberBuffer, (unrealProp.Property->ElementSize * unrealProp.Property->ArrayDim), EWidthTypes::Size);
                             classStream << ") UNKNOWN PROPERTY: " << unrealProp.Property->GetFullName() << "\n";
                             Printer::Empty(propertyStream);
 
@@ -2463,16 +3141,17 @@ namespace ClassGenerator
 
                         if (missedOffset >= GConfig::GetGameAlignment())
                         {
-                            std::string missedStr = Printer::Hex(missedOffset);
-                            propertyStream << "UnknownData" << Printer::Decimal(unknownDataIndex, EWidthTypes::Byte);
+                            Printer::NumberBuffer missedBuffer;
+                            std::string_view missedStr = Printer::Hex(missedBuffer, missedOffset);
+                            propertyStream << "UnknownData" << Printer::Decimal(numberBuffer, unknownDataIndex, EWidthTypes::Byte);
                             propertyStream << "[" << missedStr << "];";
 
                             Printer::FillLeft(classStream, ' ', (GConfig::GetClassSpacing() + UNKNOWN_DATA_SPACING));
                             classStream << "\tuint8_t";
                             Printer::FillLeft(classStream, ' ', ((GConfig::GetClassSpacing() - missedStr.length()) + UNKNOWN_DATA_SPACING));
 
-                            classStream << propertyStream.str() << "// " << Printer::Hex(lastOffset, EWidthTypes::Size);
-                            classStream << " (" << Printer::Hex(missedOffset, EWidthTypes::Size) << ") MISSED OFFSET\n";
+                            classStream << propertyStream.str() << "// " << Printer::Hex(numberBuffer, lastOffset, EWidthTypes::Size);
+                            classStream << " (" << Printer::Hex(numberBuffer, missedOffset, EWidthTypes::Size) << ") MISSED OFFSET\n";
                             Printer::Empty(propertyStream);
                         }
                     }
@@ -2536,7 +3215,7 @@ namespace ClassGenerator
         }
     }
 
-    void GenerateClassPre(std::ofstream& file, const UnrealObject& unrealObj, class UObject* packageObj)
+    void PlanClassPre(std::vector<UnrealObject>& plan, const UnrealObject& unrealObj, class UObject* packageObj)
     {
         if (unrealObj.IsValid() && !m_generatedClasses.contains(unrealObj.FullName))
         {
@@ -2549,48 +3228,66 @@ namespace ClassGenerator
 
             if (uClass->SuperField && (uClass->SuperField != uClass))
             {
-                if (!m_generatedClasses.contains(uClass->SuperField->GetFullName()))
+                if (!m_generatedClasses.contains(GCache::GetFullName(uClass->SuperField)))
                 {
-                    GenerateClassPre(file, static_cast<UClass*>(uClass->SuperField), packageObj);
+                    PlanClassPre(plan, static_cast<UClass*>(uClass->SuperField), packageObj);
                 }
             }
 
-            GenerateClass(file, uClass);
+            plan.push_back(uClass);
             m_generatedClasses[unrealObj.FullName] = uClass->ObjectInternalInteger;
         }
     }
 
-    void ProcessClasses(std::ofstream& stream, class UObject* packageObj)
+    void PlanClasses(class UObject* packageObj)
     {
         if (packageObj)
         {
             std::vector<UnrealObject>* objCache = GCache::GetCache(packageObj, EClassTypes::UClass);
+            std::vector<UnrealObject>& plan = m_plannedClasses[packageObj];
 
             if (objCache)
             {
                 for (const UnrealObject& unrealObj : *objCache)
                 {
-                    GenerateClassPre(stream, unrealObj, packageObj);
+                    PlanClassPre(plan, unrealObj, packageObj);
                 }
             }
         }
     }
+
+    const std::vector<UnrealObject>* GetPlan(class UObject* packageObj)
+    {
+        auto planIt = m_plannedClasses.find(packageObj);
+        return ((planIt != m_plannedClasses.end()) ? &planIt->second : nullptr);
+    }
+
+    void ProcessClasses(TextBuffer& stream, class UObject* packageObj)
+    {
+        auto planIt = m_plannedClasses.find(packageObj);
+
+        if (planIt != m_plannedClasses.end())
+        {
+            Utils::GenerateInOrder(stream, planIt->second, GenerateClass);
+        }
+    }
 }
 
 namespace ParameterGenerator
 {
-    void GenerateParameter(std::ofstream& file, const UnrealObject& unrealObj)
+    void GenerateParameter(TextBuffer& file, const UnrealObject& unrealObj)
     {
-        std::ostringstream parameterStream;
-        std::ostringstream propertyStream;
-        std::ostringstream flagStream;
+        TextBuffer parameterStream;
+        TextBuffer propertyStream;
+        TextBuffer flagStream;
+        Printer::NumberBuffer numberBuffer;
 
         UClass* uClass = static_cast<UClass*>(unrealObj.Object);
         std::vector<UnrealObject> classFunctions;
 
         for (UProperty* uProperty = static_cast<UProperty*>(uClass->Children); uProperty; uProperty = static_cast<UProperty*>(uProperty->Next))
         {
-            if (uProperty && uProperty->IsA<UFunction>())
+            if (uProperty && GCache::IsA(uProperty, ANCESTRY_Function))
             {
                 classFunctions.push_back(UnrealObject(uProperty));
             }
@@ -2604,7 +3301,7 @@ namespace ParameterGenerator
             {
                 UFunction* uFunction = static_cast<UFunction*>(functionObj.Object);
                 parameterStream << "// " << functionObj.FullName << "\n";
-                parameterStream << "// [" << Printer::Hex(uFunction->FunctionFlags, EWidthTypes::FunctionFlags) << "] ";
+                parameterStream << "// [" << Printer::Hex(numberBuffer, uFunction->FunctionFlags, EWidthTypes::FunctionFlags) << "] ";
 
                 if ((uFunction->FunctionFlags & EFunctionFlags::FUNC_Native) && uFunction->iNative)
                 {
@@ -2644,7 +3341,7 @@ namespace ParameterGenerator
                         }
                         else
                         {
-                            propertyStream << unrealProp.ValidName << Printer::Decimal(propertyNameMap.at(unrealProp.ValidName), EWidthTypes::Byte);
+                            propertyStream << unrealProp.ValidName << Printer::Decimal(numberBuffer, propertyNameMap.at(unrealProp.ValidName), EWidthTypes::Byte);
                             propertyNameMap[unrealProp.ValidName]++;
                         }
 
@@ -2681,13 +3378,13 @@ namespace ParameterGenerator
                         parameterStream << propertyType << " ";
                         Printer::FillLeft(parameterStream, ' ', GConfig::GetFunctionSpacing());
 
-                        parameterStream << propertyStream.str() << "// " << Printer::Hex(unrealProp.Property->Offset, EWidthTypes::Size);
-                        parameterStream << " (" << Printer::Hex((unrealProp.Property->ElementSize * unrealProp.Property->ArrayDim), EWidthTypes::Size) << ")";
-                        parameterStream << " [" << Printer::Hex(unrealProp.Property->PropertyFlags, EWidthTypes::PropertyFlags) << "] ";
+                        parameterStream << propertyStream.str() << "// " << Printer::Hex(numberBuffer, unrealProp.Property->Offset, EWidthTypes::Size);
+                        parameterStream << " (" << Printer::Hex(numberBuffer, (unrealProp.Property->ElementSize * unrealProp.Property->ArrayDim), EWidthTypes::Size) << ")";
+                        parameterStream << " [" << Printer::Hex(numberBuffer, unrealProp.Property->PropertyFlags, EWidthTypes::PropertyFlags) << "] ";
 
                         if (unrealProp.Type == EPropertyTypes::Bool)
                         {
-                            parameterStream << "[" << Printer::Hex(static_cast<UBoolProperty*>(unrealProp.Property)->BitMask, EWidthTypes::BitMask) << "] ";
+                            parameterStream << "[" << Printer::Hex(numberBuffer, static_cast<UBoolProperty*>(unrealProp.Property)->BitMask, EWidthTypes::BitMask) << "] ";
                         }
                         else
                         {
@@ -2711,7 +3408,7 @@ namespace ParameterGenerator
         file << parameterStream.str();
     }
 
-    void ProcessParameters(std::ofstream& stream, UObject* packageObj)
+    void ProcessParameters(TextBuffer& stream, UObject* packageObj)
     {
         if (packageObj)
         {
@@ -2719,10 +3416,7 @@ namespace ParameterGenerator
 
             if (objCache)
             {
-                for (const UnrealObject& unrealObj : *objCache)
-                {
-                    GenerateParameter(stream, unrealObj);
-                }
+                Utils::GenerateInOrder(stream, *objCache, GenerateParameter);
             }
         }
     }
@@ -2730,45 +3424,91 @@ namespace ParameterGenerator
 
 namespace FunctionGenerator
 {
-    static bool m_printedObjects = false;
-    static bool m_printedFunctions = false;
+    static std::atomic<bool> m_printedObjects = false; // Atomic because classes from different packages are generated at the same time.
+    static std::atomic<bool> m_printedFunctions = false;
 
-    void GenerateVirtualFunctions(std::ofstream& stream)
+    uintptr_t GetProcessEventAddress()
     {
-        uintptr_t processEventAddress = 0;
-
         if (!GConfig::UsingProcessEventIndex())
         {
-            processEventAddress = Retrievers::FindPattern(GConfig::GetProcessEventPattern(), GConfig::GetProcessEventMask());
+            if (Snapshot::IsLoaded())
+            {
+                return Snapshot::GetProcessEvent(); // The game isn't running so there's nothing to scan, this was found when the snapshot was captured.
+            }
+
+            return Generator::GetProcessEvent(); // Scanned for along with the globals.
         }
         else if (GConfig::GetProcessEventIndex() != -1)
         {
-            processEventAddress = reinterpret_cast<uintptr_t*>(UObject::StaticClass()->VfTableObject.Dummy)[GConfig::GetProcessEventIndex()];
+            uintptr_t* vfTable = reinterpret_cast<uintptr_t*>(UObject::StaticClass()->VfTableObject.Dummy);
+
+            if (vfTable)
+            {
+                return vfTable[GConfig::GetProcessEventIndex()];
+            }
         }
-        else
+
+        return 0;
+    }
+
+    // Walks the vftable the same way "GenerateVirtualFunctions" does, which is up to process event or the first 1024 entries.
+    uint64_t HashVirtualFunctions(uint64_t seed)
+    {
+        uintptr_t processEventAddress = GetProcessEventAddress();
+        uintptr_t* vfTable = reinterpret_cast<uintptr_t*>(UObject::StaticClass()->VfTableObject.Dummy);
+        bool bFound = (processEventAddress && vfTable);
+        int32_t processEventSlot = -1;
+        uint32_t walkedLength = 0;
+
+        if (bFound)
+        {
+            for (uint32_t index = 0; index < 1024; index++)
+            {
+                walkedLength++;
+
+                if (vfTable[index] == processEventAddress)
+                {
+                    processEventSlot = static_cast<int32_t>(index);
+                    break;
+                }
+            }
+        }
+
+        seed = Utils::Hash(bFound, seed);
+        seed = Utils::Hash(static_cast<uint64_t>(processEventSlot), seed);
+        return Utils::Hash(walkedLength, seed);
+    }
+
+    void GenerateVirtualFunctions(TextBuffer& stream)
+    {
+        Printer::NumberBuffer numberBuffer;
+        uintptr_t processEventAddress = GetProcessEventAddress();
+        uintptr_t* vfTable = reinterpret_cast<uintptr_t*>(UObject::StaticClass()->VfTableObject.Dummy); // Can be null when generating offline, if the vftable wasn't dumped with the heap image.
+
+        if (GConfig::UsingProcessEventIndex() && (GConfig::GetProcessEventIndex() == -1))
         {
             stream << "\n\t// FIX PROCESSEVENT IN CONFIGURATION.CPP, INVALID INDEX";
             Utils::MessageboxWarn("Warning: ProcessEvent is not configured correctly in \"Configuration.cpp\", you set \"UsingIndex\" to true yet you did not provide a valid index for process event!");
         }
 
-        if (processEventAddress)
+        if (processEventAddress && vfTable)
         {
             stream << "\n\t// Virtual Functions\n\n";
 
             for (uint32_t index = 0; index < 1024; index++) // 1024 is just for infinite loop protection.
             {
-                uintptr_t virtualFunction = reinterpret_cast<uintptr_t*>(UObject::StaticClass()->VfTableObject.Dummy)[index];
+                uintptr_t virtualFunction = vfTable[index];
 
                 if (virtualFunction == processEventAddress)
                 {
                     stream << "\tvirtual void ProcessEvent(class UFunction* uFunction, void* uParams, void* uResult = nullptr);";
-                    stream << "\t// " << Printer::Hex(virtualFunction, sizeof(virtualFunction)) << "\n";
+                    stream << "\t// " << Printer::Hex(numberBuffer, virtualFunction, sizeof(virtualFunction)) << "\n";
                     break;
                 }
                 else
                 {
-                    stream << "\tvirtual void VirtualFunction" << Printer::Decimal(index, EWidthTypes::Byte) << "();";
-                    stream << "\t// " << Printer::Hex(virtualFunction, sizeof(virtualFunction)) << "\n";
+                    stream << "\tvirtual void VirtualFunction" << Printer::Decimal(numberBuffer, index, EWidthTypes::Byte) << "();";
+                    stream << "\t// " << Printer::Hex(numberBuffer, virtualFunction, sizeof(virtualFunction)) << "\n";
                 }
             }
         }
@@ -2779,16 +3519,17 @@ namespace FunctionGenerator
         }
     }
 
-    void GenerateFunctionCode(std::ofstream& stream, const UnrealObject& unrealObj)
+    void GenerateFunctionCode(TextBuffer& stream, const UnrealObject& unrealObj)
     {
         if (unrealObj.IsValid())
         {
             UClass* uClass = static_cast<UClass*>(unrealObj.Object);
             std::string classNameCPP = UnrealObject::CreateValidName(uClass->GetNameCPP());
-            std::ostringstream codeStream;
-            std::ostringstream functionStream;
+            TextBuffer codeStream;
+            TextBuffer functionStream;
+            Printer::NumberBuffer numberBuffer;
 
-            if (!m_printedObjects && (uClass == UObject::StaticClass()))
+            if ((uClass == UObject::StaticClass()) && !m_printedObjects.exchange(true))
             {
                 codeStream << PiecesOfCode::UObject_Functions;
 
@@ -2805,21 +3546,18 @@ namespace FunctionGenerator
                     codeStream << "\tGetVirtualFunction<void(*)(class UObject*, class UFunction*, void*)>(this, " << GConfig::GetProcessEventIndex() << ")(this, uFunction, uParams);\n";
                     codeStream << "}\n\n";
                 }
-
-                m_printedObjects = true;
             }
 
-            if (!m_printedFunctions && (uClass == UFunction::StaticClass()))
+            if ((uClass == UFunction::StaticClass()) && !m_printedFunctions.exchange(true))
             {
                 codeStream << PiecesOfCode::UFunction_Functions;
-                m_printedFunctions = true;
             }
 
             std::vector<UnrealObject> classFunctions;
 
             for (UField* uField = uClass->Children; uField; uField = uField->Next)
             {
-                if (uField && uField->IsA<UFunction>())
+                if (uField && GCache::IsA(uField, ANCESTRY_Function))
                 {
                     classFunctions.push_back(UnrealObject(uField));
                 }
@@ -2832,7 +3570,7 @@ namespace FunctionGenerator
                     UFunction* uFunction = static_cast<UFunction*>(functionObj.Object);
                     Retrievers::GetAllFunctionFlags(functionStream, uFunction->FunctionFlags);
                     codeStream << "// " << functionObj.FullName << "\n";
-                    codeStream << "// [" << Printer::Hex(uFunction->FunctionFlags, EWidthTypes::FunctionFlags) << "] " << functionStream.str();
+                    codeStream << "// [" << Printer::Hex(numberBuffer, uFunction->FunctionFlags, EWidthTypes::FunctionFlags) << "] " << functionStream.str();
                     Printer::Empty(functionStream);
 
                     if ((uFunction->FunctionFlags & EFunctionFlags::FUNC_Native) && uFunction->iNative)
@@ -2861,7 +3599,7 @@ namespace FunctionGenerator
                             }
                             else
                             {
-                                functionStream << unrealProp.ValidName << Printer::Decimal(propertyNameMap.at(unrealProp.ValidName), EWidthTypes::Byte);
+                                functionStream << unrealProp.ValidName << Printer::Decimal(numberBuffer, propertyNameMap.at(unrealProp.ValidName), EWidthTypes::Byte);
                                 propertyNameUnique = functionStream.str();
                                 Printer::Empty(functionStream);
                                 propertyNameMap[unrealProp.ValidName]++;
@@ -3085,7 +3823,7 @@ namespace FunctionGenerator
 
                     if (GConfig::RemoveNativeFlags() && hasNativeFlags)
                     {
-                        codeStream << "\n\tuFn" << functionObj.ValidName << "->FunctionFlags &= ~" << Printer::Hex(EFunctionFlags::FUNC_Native) << ";";
+                        codeStream << "\n\tuFn" << functionObj.ValidName << "->FunctionFlags &= ~" << Printer::Hex(numberBuffer, EFunctionFlags::FUNC_Native) << ";";
                     }
 
                     if ((uFunction->FunctionFlags & EFunctionFlags::FUNC_Static) && (uFunction->FunctionFlags != EFunctionFlags::FUNC_AllFlags))
@@ -3099,7 +3837,7 @@ namespace FunctionGenerator
 
                     if (hasNativeFlags && GConfig::RemoveNativeFlags())
                     {
-                        codeStream << "\tuFn" << functionObj.ValidName << "->FunctionFlags |= " << Printer::Hex(EFunctionFlags::FUNC_Native) << ";\n";
+                        codeStream << "\tuFn" << functionObj.ValidName << "->FunctionFlags |= " << Printer::Hex(numberBuffer, EFunctionFlags::FUNC_Native) << ";\n";
                     }
 
                     if (hasNativeFlags && hasNativeIndex && GConfig::RemoveNativeIndex())
@@ -3170,18 +3908,19 @@ namespace FunctionGenerator
         }
     }
 
-    void GenerateFunctionParameters(std::ofstream& stream, const UnrealObject& unrealObj)
+    void GenerateFunctionParameters(TextBuffer& stream, const UnrealObject& unrealObj)
     {
         if (unrealObj.IsValid())
         {
             UClass* uClass = static_cast<UClass*>(unrealObj.Object);
-            std::ostringstream functionStream;
-            std::ostringstream propertyStream;
+            TextBuffer functionStream;
+            TextBuffer propertyStream;
+            Printer::NumberBuffer numberBuffer;
             std::vector<UnrealObject> classFunctions;
 
             for (UField* uField = uClass->Children; uField; uField = uField->Next)
             {
-                if (uField && uField->IsA<UFunction>())
+                if (uField && GCache::IsA(uField, ANCESTRY_Function))
                 {
                     classFunctions.push_back(UnrealObject(uField));
                 }
@@ -3212,7 +3951,7 @@ namespace FunctionGenerator
                             }
                             else
                             {
-                                propertyStream << unrealProp.ValidName << Printer::Decimal(propertyNameMap.at(unrealProp.ValidName), EWidthTypes::Byte);
+                                propertyStream << unrealProp.ValidName << Printer::Decimal(numberBuffer, propertyNameMap.at(unrealProp.ValidName), EWidthTypes::Byte);
                                 propertyNameUnique = propertyStream.str();
                                 Printer::Empty(propertyStream);
                                 propertyNameMap[unrealProp.ValidName]++;
@@ -3313,18 +4052,44 @@ namespace FunctionGenerator
         }
     }
 
-    void ProcessFunctions(std::ofstream& stream, class UObject* packageObj)
+    // Counts the functions declared by a package's classes, used to balance unity files by how much code they'll end up compiling.
+    size_t CountFunctions(class UObject* packageObj)
+    {
+        size_t functionCount = 0;
+        std::vector<UnrealObject>* objCache = GCache::GetCache(packageObj, EClassTypes::UClass);
+
+        if (objCache)
+        {
+            for (const UnrealObject& unrealObj : *objCache)
+            {
+                if (unrealObj.IsValid())
+                {
+                    for (UField* uField = static_cast<UClass*>(unrealObj.Object)->Children; uField; uField = uField->Next)
+                    {
+                        if (GCache::IsA(uField, ANCESTRY_Function))
+                        {
+                            functionCount++;
+                        }
+                    }
+                }
+            }
+        }
+
+        return functionCount;
+    }
+
+    // Each class gets its own stream, so the package can be split into chunks without cutting a class in half.
+    void ProcessFunctions(std::vector<TextBuffer>& streams, class UObject* packageObj)
     {
+        streams.clear();
+
         if (packageObj)
         {
             std::vector<UnrealObject>* objCache = GCache::GetCache(packageObj, EClassTypes::UClass);
 
             if (objCache)
             {
-                for (const UnrealObject& unrealObj : *objCache)
-                {
-                    GenerateFunctionCode(stream, unrealObj);
-                }
+                Utils::GenerateInOrder(streams, *objCache, GenerateFunctionCode);
             }
         }
     }
@@ -3332,11 +4097,21 @@ namespace FunctionGenerator
 
 namespace Generator
 {
+    static bool m_initialized = false;
+    static uintptr_t m_processEvent = 0; // Found along with the globals when process event isn't being used by its index, so the module only has to be scanned once.
+    static std::map<std::string, uint64_t> m_previousFingerprints; // Package names to the fingerprint they were last generated with, loaded from "PackageManifest.txt".
+    static std::map<std::string, uint64_t> m_fingerprints;
+    static std::map<std::string, uint32_t> m_previousFunctionFiles; // Package names to how many "_classes.cpp" files they were split into last time.
+    static std::map<std::string, uint32_t> m_functionFiles;
+    static std::unordered_map<std::string, class UObject*> m_structOwners; // Struct full names to the package they're generated in, which isn't always the package they're from.
+    static std::unordered_map<class UObject*, std::string> m_packageNames;
+    static std::unordered_map<class UObject*, FPackageDependencies> m_dependencies;
+
     void GenerateConstants()
     {
         if (GConfig::UsingConstants())
         {
-            std::ofstream constantsFile(GConfig::GetOutputPath() / GConfig::GetGameNameShort() / "SdkConstants.hpp");
+            TextBuffer constantsFile;
             constantsFile << "#pragma once\n";
 
             std::map<std::string, class UObject*>* constants = GCache::GetConstants();
@@ -3351,13 +4126,38 @@ namespace Generator
                 }
             }
 
-            constantsFile.close();
+            GWriter::Write((GConfig::GetOutputPath() / GConfig::GetGameNameShort() / "SdkConstants.hpp"), constantsFile.release());
+        }
+    }
+
+    // Pastes a generated header into the amalgamated one, minus the lines that only make sense when it's included on its own.
+    bool AmalgamateHeader(TextBuffer& stream, const std::filesystem::path& file)
+    {
+        std::ifstream headerFile(file);
+
+        if (headerFile.is_open())
+        {
+            std::string line;
+
+            while (std::getline(headerFile, line))
+            {
+                if ((line != "#pragma once") && (line.rfind("#include \"", 0) != 0))
+                {
+                    stream << line << "\n";
+                }
+            }
+
+            stream << "\n";
+            return true;
         }
+
+        return false;
     }
 
     void GenerateHeaders()
     {
-        std::ofstream headersFile(GConfig::GetOutputPath() / GConfig::GetGameNameShort() / "SdkHeaders.hpp");
+        TextBuffer headersFile;
+        std::filesystem::path fullDirectory = (GConfig::GetOutputPath() / GConfig::GetGameNameShort());
 
         Printer::Header(headersFile, "SdkHeaders", "hpp", false);
         headersFile << "#pragma once\n";
@@ -3366,46 +4166,169 @@ namespace Generator
         headersFile << "#include \"GameDefines.hpp\"\n";
         std::vector<UnrealObject>* packages = GCache::GetPackages();
 
-        for (const UnrealObject& packageObj : *packages)
+        if (GConfig::AmalgamatingHeaders())
         {
-            if (packageObj.IsValid())
+            if (GConfig::UsingConstants())
             {
-                headersFile << "#include \"SDK_HEADERS/" << packageObj.ValidName << "_structs.hpp\"\n";
-                headersFile << "#include \"SDK_HEADERS/" << packageObj.ValidName << "_classes.hpp\"\n";
-                headersFile << "#include \"SDK_HEADERS/" << packageObj.ValidName << "_parameters.hpp\"\n";
+                headersFile << "#include \"SdkConstants.hpp\"\n";
             }
-        }
 
-        headersFile << "\n";
+            headersFile << "\n";
 
-        Printer::Footer(headersFile, false);
-        headersFile.close();
-    }
+            // Skipped packages never went through the generator this run, so every package header is read back from disk once it's been written.
+            GWriter::Flush();
 
-    void GenerateDefines()
-    {
-        std::ofstream definesFile(GConfig::GetOutputPath() / GConfig::GetGameNameShort() / "GameDefines.hpp");
-        Printer::Header(definesFile, "GameDefines", "hpp", false);
+            for (const UnrealObject& packageObj : *packages)
+            {
+                if (packageObj.IsValid())
+                {
+                    for (const char* headerType : { "_structs.hpp", "_classes.hpp", "_parameters.hpp" })
+                    {
+                        std::string headerName = (packageObj.ValidName + headerType);
 
-        definesFile << "#pragma once\n";
+                        if (!AmalgamateHeader(headersFile, (fullDirectory / "SDK_HEADERS" / headerName)))
+                        {
+#ifndef NO_LOGGING
+                            GLogger::Log("Error: Failed to amalgamate \"" + headerName + "\", it will be included instead!");
+#endif
+                            headersFile << "#include \"SDK_HEADERS/" << headerName << "\"\n\n";
+                        }
+                    }
+                }
+            }
 
-        if (GConfig::UsingWindows())
-        {
-            definesFile << "#include <windows.h>\n";
-        }
+            Printer::Footer(headersFile, false);
+            GWriter::Write((fullDirectory / "SdkHeaders.hpp"), headersFile.release());
 
-        definesFile << "#include <algorithm>\n";
-        definesFile << "#include <locale>\n";
-        definesFile << "#include <stdlib.h>\n";
-        definesFile << "#include <xlocale>\n";
-        definesFile << "#include <ctype.h>\n";
-        definesFile << "#include <chrono>\n";
-        definesFile << "#include <thread>\n";
-        definesFile << "#include <vector>\n";
-        definesFile << "#include <string>\n";
-        definesFile << "#include <map>\n";
+            // Precompiled header stub, "SdkPch.cpp" is the one file built with "/Yc" and everything else uses "/Yu".
+            Printer::Header(headersFile, "SdkPch", "hpp", false);
+            headersFile << "#pragma once\n";
+            headersFile << "#include \"SdkHeaders.hpp\"\n";
+            GWriter::Write((fullDirectory / "SdkPch.hpp"), headersFile.release());
 
-        if (GConfig::PrintEnumFlags())
+            Printer::Header(headersFile, "SdkPch", "cpp", false);
+            headersFile << "#include \"SdkPch.hpp\"\n";
+            GWriter::Write((fullDirectory / "SdkPch.cpp"), headersFile.release());
+        }
+        else
+        {
+            for (const UnrealObject& packageObj : *packages)
+            {
+                if (packageObj.IsValid())
+                {
+                    headersFile << "#include \"SDK_HEADERS/" << packageObj.ValidName << "_structs.hpp\"\n";
+                    headersFile << "#include \"SDK_HEADERS/" << packageObj.ValidName << "_classes.hpp\"\n";
+                    headersFile << "#include \"SDK_HEADERS/" << packageObj.ValidName << "_parameters.hpp\"\n";
+                }
+            }
+
+            headersFile << "\n";
+
+            Printer::Footer(headersFile, false);
+            GWriter::Write((fullDirectory / "SdkHeaders.hpp"), headersFile.release());
+        }
+    }
+
+    // Packages are spread over the unity files by their function count instead of evenly, the largest package always goes to the file with the least so far.
+    void GenerateUnityFiles()
+    {
+        std::filesystem::path fullDirectory = (GConfig::GetOutputPath() / GConfig::GetGameNameShort());
+        uint32_t unityCount = GConfig::GetUnityFileCount();
+
+        if (unityCount > 0)
+        {
+            std::vector<std::pair<size_t, size_t>> packageWeights; // Function count to package index.
+            std::vector<UnrealObject>* packages = GCache::GetPackages();
+
+            for (size_t packageIndex = 0; packageIndex < packages->size(); packageIndex++)
+            {
+                const UnrealObject& packageObj = (*packages)[packageIndex];
+
+                if (packageObj.IsValid())
+                {
+                    packageWeights.emplace_back((FunctionGenerator::CountFunctions(packageObj.Object) + 1), packageIndex); // Plus one so packages without functions still count for something.
+                }
+            }
+
+            std::stable_sort(packageWeights.begin(), packageWeights.end(), [](const std::pair<size_t, size_t>& a, const std::pair<size_t, size_t>& b) { return (a.first > b.first); });
+
+            std::vector<size_t> unityWeights(unityCount, 0);
+            std::vector<std::vector<size_t>> unityPackages(unityCount);
+
+            for (const std::pair<size_t, size_t>& packageWeight : packageWeights)
+            {
+                size_t lightestUnity = (std::min_element(unityWeights.begin(), unityWeights.end()) - unityWeights.begin());
+                unityWeights[lightestUnity] += packageWeight.first;
+                unityPackages[lightestUnity].push_back(packageWeight.second);
+            }
+
+            for (uint32_t unityIndex = 0; unityIndex < unityCount; unityIndex++)
+            {
+                // Included in package order, the same order "SdkHeaders.hpp" uses.
+                std::sort(unityPackages[unityIndex].begin(), unityPackages[unityIndex].end());
+
+                Printer::NumberBuffer numberBuffer;
+                std::string unityName = std::string("SdkUnity_").append(Printer::Decimal(numberBuffer, (unityIndex + 1), 2));
+                TextBuffer unityFile;
+
+                Printer::Header(unityFile, unityName, "cpp", false);
+                unityFile << "// Functions: " << unityWeights[unityIndex] << "\n";
+                unityFile << (GConfig::AmalgamatingHeaders() ? "#include \"SdkPch.hpp\"\n" : "#include \"SdkHeaders.hpp\"\n");
+
+                for (size_t packageIndex : unityPackages[unityIndex])
+                {
+                    const std::string& packageName = (*packages)[packageIndex].ValidName;
+                    uint32_t functionFiles = m_functionFiles[packageName];
+
+                    for (uint32_t chunkIndex = 0; chunkIndex < functionFiles; chunkIndex++)
+                    {
+                        unityFile << "#include \"SDK_HEADERS/" << GetFunctionFile(packageName, chunkIndex, functionFiles) << "\"\n";
+                    }
+                }
+
+                GWriter::Write((fullDirectory / (unityName + ".cpp")), unityFile.release());
+            }
+        }
+
+        // Unity files from a previous run with a higher count would otherwise get compiled along with the new ones.
+        for (uint32_t unityIndex = unityCount; unityIndex < 100; unityIndex++)
+        {
+            Printer::NumberBuffer numberBuffer;
+            std::filesystem::path unityFile = (fullDirectory / std::string("SdkUnity_").append(Printer::Decimal(numberBuffer, (unityIndex + 1), 2)).append(".cpp"));
+            std::error_code removeError;
+
+            if (!std::filesystem::remove(unityFile, removeError))
+            {
+                break;
+            }
+        }
+    }
+
+    void GenerateDefines()
+    {
+        Printer::NumberBuffer numberBuffer;
+        TextBuffer definesFile;
+        Printer::Header(definesFile, "GameDefines", "hpp", false);
+
+        definesFile << "#pragma once\n";
+
+        if (GConfig::UsingWindows())
+        {
+            definesFile << "#include <windows.h>\n";
+        }
+
+        definesFile << "#include <algorithm>\n";
+        definesFile << "#include <locale>\n";
+        definesFile << "#include <stdlib.h>\n";
+        definesFile << "#include <xlocale>\n";
+        definesFile << "#include <ctype.h>\n";
+        definesFile << "#include <chrono>\n";
+        definesFile << "#include <thread>\n";
+        definesFile << "#include <vector>\n";
+        definesFile << "#include <string>\n";
+        definesFile << "#include <map>\n";
+
+        if (GConfig::PrintEnumFlags())
         {
             Printer::Section(definesFile, "Flags");
             definesFile << PiecesOfCode::EEnumFlags;
@@ -3416,10 +4339,10 @@ namespace Generator
         if (GConfig::UsingOffsets())
         {
             definesFile << "// GObjects\n";
-            definesFile << "#define GObjects_Offset\t\t(uintptr_t)" << Printer::Hex(GConfig::GetGObjectOffset(), sizeof(uintptr_t)) << "\n";
+            definesFile << "#define GObjects_Offset\t\t(uintptr_t)" << Printer::Hex(numberBuffer, GConfig::GetGObjectOffset(), sizeof(uintptr_t)) << "\n";
 
             definesFile << "// GNames\n";
-            definesFile << "#define GNames_Offset\t\t(uintptr_t)" << Printer::Hex(GConfig::GetGNameOffset(), sizeof(uintptr_t)) << "\n";
+            definesFile << "#define GNames_Offset\t\t(uintptr_t)" << Printer::Hex(numberBuffer, GConfig::GetGNameOffset(), sizeof(uintptr_t)) << "\n";
         }
         else
         {
@@ -3427,13 +4350,28 @@ namespace Generator
             definesFile << "#define GObjects_Pattern\t\t(const uint8_t*)\"" << GConfig::GetGObjectStr() + "\"\n";
             definesFile << "#define GObjects_Mask\t\t\t(const char*)\"" << GConfig::GetGObjectMask() + "\"\n";
 
+            if (!GConfig::GetGObjectSignature().IsEmpty())
+            {
+                definesFile << "#define GObjects_Signature\t\t(const char*)\"" << GConfig::GetGObjectSignature().Text << "\"\n";
+            }
+
             definesFile << "// GNames\n";
             definesFile << "#define GNames_Pattern\t\t\t(const uint8_t*)\"" << GConfig::GetGNameStr() + "\"\n";
             definesFile << "#define GNames_Mask\t\t\t\t(const char*)\"" << GConfig::GetGNameStr() + "\"\n";
 
+            if (!GConfig::GetGNameSignature().IsEmpty())
+            {
+                definesFile << "#define GNames_Signature\t\t(const char*)\"" << GConfig::GetGNameSignature().Text << "\"\n";
+            }
+
             definesFile << "// Process Event\n";
             definesFile << "#define ProcessEvent_Pattern\t(const uint8_t*)\"" << GConfig::GetProcessEventStr() << "\"\n";
             definesFile << "#define ProcessEvent_Mask\t\t(const char*)\"" << GConfig::GetProcessEventMask() << "\"\n";
+
+            if (!GConfig::GetProcessEventSignature().IsEmpty())
+            {
+                definesFile << "#define ProcessEvent_Signature\t(const char*)\"" << GConfig::GetProcessEventSignature().Text << "\"\n";
+            }
         }
 
         Printer::Section(definesFile, "Classes");
@@ -3467,9 +4405,8 @@ namespace Generator
         definesFile << PiecesOfCode::FQWord_Struct << "\n";
 
         Printer::Footer(definesFile, false);
-        definesFile.close();
+        GWriter::Write((GConfig::GetOutputPath() / GConfig::GetGameNameShort() / "GameDefines.hpp"), definesFile.release());
 
-        definesFile.open(GConfig::GetOutputPath() / GConfig::GetGameNameShort() / "GameDefines.cpp");
         Printer::Header(definesFile, "GameDefines", "cpp", false);
 
         definesFile << "#include \"GameDefines.hpp\"\n";
@@ -3478,61 +4415,568 @@ namespace Generator
         definesFile << "class TArray<class FNameEntry*>* GNames{};\n\n";
 
         Printer::Footer(definesFile, false);
-        definesFile.close();
+        GWriter::Write((GConfig::GetOutputPath() / GConfig::GetGameNameShort() / "GameDefines.cpp"), definesFile.release());
+    }
+
+    // Every package that generates a struct or class is decided here first, one package after another, which is the only part that depends on the order of packages.
+    void PlanPackages()
+    {
+        m_structOwners.clear();
+        m_packageNames.clear();
+
+        for (const UnrealObject& packageObj : *GCache::GetPackages())
+        {
+            if (packageObj.IsValid())
+            {
+                StructGenerator::PlanStructs(packageObj.Object);
+                ClassGenerator::PlanClasses(packageObj.Object);
+                m_packageNames[packageObj.Object] = packageObj.ValidName;
+
+                const std::vector<UnrealObject>* structPlan = StructGenerator::GetPlan(packageObj.Object);
+
+                if (structPlan)
+                {
+                    for (const UnrealObject& unrealObj : *structPlan)
+                    {
+                        m_structOwners[unrealObj.FullName] = packageObj.Object;
+                    }
+                }
+            }
+        }
+    }
+
+    void AddInclude(FHeaderDependencies& dependencies, class UObject* packageObj, const std::string& fileSuffix)
+    {
+        auto nameIt = m_packageNames.find(packageObj);
+
+        if (nameIt != m_packageNames.end())
+        {
+            dependencies.Includes.insert(nameIt->second + fileSuffix);
+        }
+    }
+
+    // The file type is "UStruct" for "_structs.hpp", "UClass" for "_classes.hpp", and "UFunction" for "_parameters.hpp".
+    // Struct by value need the header that defines them, pointers and enum classes only ever need a forward declaration.
+    void AddPropertyDependencies(FHeaderDependencies& dependencies, class UProperty* uProperty, class UObject* packageObj, EClassTypes fileType, bool bByValue)
+    {
+        UnrealProperty unrealProp(uProperty);
+
+        if (!unrealProp.IsValid())
+        {
+            return;
+        }
+
+        if (unrealProp.Type == EPropertyTypes::FStruct)
+        {
+            UScriptStruct* propertyStruct = static_cast<UScriptStruct*>(static_cast<UStructProperty*>(uProperty)->Struct);
+
+            if (propertyStruct && bByValue)
+            {
+                auto ownerIt = m_structOwners.find(GCache::GetFullName(propertyStruct));
+
+                if ((ownerIt != m_structOwners.end()) && ((ownerIt->second != packageObj) || (fileType != EClassTypes::UStruct)))
+                {
+                    AddInclude(dependencies, ownerIt->second, "_structs.hpp");
+                }
+            }
+        }
+        else if (unrealProp.Type == EPropertyTypes::TArray)
+        {
+            UArrayProperty* arrayProperty = static_cast<UArrayProperty*>(uProperty);
+
+            if (arrayProperty->Inner)
+            {
+                AddPropertyDependencies(dependencies, arrayProperty->Inner, packageObj, fileType, bByValue); // Same as the struct planner, array structs are treated like they're by value.
+            }
+        }
+        else if ((unrealProp.Type == EPropertyTypes::UObject) || (unrealProp.Type == EPropertyTypes::UClass) || (unrealProp.Type == EPropertyTypes::UInterface))
+        {
+            UClass* propertyClass = nullptr;
+
+            if (unrealProp.Type == EPropertyTypes::UObject)
+            {
+                propertyClass = static_cast<UObjectProperty*>(uProperty)->PropertyClass;
+            }
+            else if (unrealProp.Type == EPropertyTypes::UClass)
+            {
+                propertyClass = static_cast<UClassProperty*>(uProperty)->MetaClass;
+            }
+            else
+            {
+                propertyClass = static_cast<UInterfaceProperty*>(uProperty)->InterfaceClass;
+            }
+
+            if (propertyClass)
+            {
+                UnrealObject classObj(propertyClass);
+
+                if (classObj.IsValid() && ((classObj.Package != packageObj) || (fileType != EClassTypes::UClass)))
+                {
+                    dependencies.Classes.insert(UnrealObject::CreateValidName(propertyClass->GetNameCPP()));
+                }
+            }
+        }
+        else if ((unrealProp.Type == EPropertyTypes::UInt8) && GConfig::UsingEnumClasses())
+        {
+            UByteProperty* byteProperty = static_cast<UByteProperty*>(uProperty);
+
+            if (byteProperty->Enum)
+            {
+                UnrealObject enumObj(byteProperty->Enum);
+
+                if (enumObj.IsValid() && ((enumObj.Package != packageObj) || (fileType != EClassTypes::UClass)))
+                {
+                    dependencies.Enums.insert(enumObj.ValidName);
+                }
+            }
+        }
+    }
+
+    void AddStructDependencies(FHeaderDependencies& dependencies, class UStruct* uStruct, class UObject* packageObj, EClassTypes fileType, bool bByValue)
+    {
+        for (UField* uField = uStruct->Children; uField; uField = uField->Next)
+        {
+            if (GCache::IsA(uField, ANCESTRY_Property))
+            {
+                AddPropertyDependencies(dependencies, static_cast<UProperty*>(uField), packageObj, fileType, bByValue);
+            }
+        }
+    }
+
+    // Class headers include the headers of their super classes and by value structs, function declarations only ever need forward declarations.
+    FPackageDependencies CreateDependencies(const UnrealObject& packageObj)
+    {
+        FPackageDependencies dependencies;
+        const std::vector<UnrealObject>* structPlan = StructGenerator::GetPlan(packageObj.Object);
+        const std::vector<UnrealObject>* classPlan = ClassGenerator::GetPlan(packageObj.Object);
+
+        if (structPlan)
+        {
+            for (const UnrealObject& unrealObj : *structPlan)
+            {
+                UStruct* uStruct = static_cast<UStruct*>(unrealObj.Object);
+
+                if (uStruct->SuperField && (uStruct->SuperField != uStruct))
+                {
+                    auto ownerIt = m_structOwners.find(GCache::GetFullName(uStruct->SuperField));
+
+                    if ((ownerIt != m_structOwners.end()) && (ownerIt->second != packageObj.Object))
+                    {
+                        AddInclude(dependencies.Structs, ownerIt->second, "_structs.hpp");
+                    }
+                }
+
+                AddStructDependencies(dependencies.Structs, uStruct, packageObj.Object, EClassTypes::UStruct, true);
+            }
+        }
+
+        if (classPlan && !classPlan->empty())
+        {
+            dependencies.Classes.Classes.insert(UnrealObject::CreateValidName(UClass::StaticClass()->GetNameCPP())); // Every class has a "StaticClass" function that returns one.
+
+            for (const UnrealObject& unrealObj : *classPlan)
+            {
+                UClass* uClass = static_cast<UClass*>(unrealObj.Object);
+
+                if (uClass->SuperField && (uClass->SuperField != uClass))
+                {
+                    UnrealObject superObj(uClass->SuperField);
+
+                    if (superObj.IsValid() && (superObj.Package != packageObj.Object))
+                    {
+                        AddInclude(dependencies.Classes, superObj.Package, "_classes.hpp");
+                    }
+                }
+
+                AddStructDependencies(dependencies.Classes, uClass, packageObj.Object, EClassTypes::UClass, true);
+
+                for (UField* uField = uClass->Children; uField; uField = uField->Next)
+                {
+                    if (GCache::IsA(uField, ANCESTRY_Function))
+                    {
+                        AddStructDependencies(dependencies.Classes, static_cast<UStruct*>(uField), packageObj.Object, EClassTypes::UClass, false);
+                        AddStructDependencies(dependencies.Parameters, static_cast<UStruct*>(uField), packageObj.Object, EClassTypes::UFunction, true);
+                    }
+                }
+            }
+        }
+
+        return dependencies;
+    }
+
+    uint64_t HashDependencies(const FHeaderDependencies& dependencies, uint64_t seed)
+    {
+        for (const std::set<std::string>* names : { &dependencies.Includes, &dependencies.Classes, &dependencies.Enums })
+        {
+            for (const std::string& name : *names)
+            {
+                seed = Utils::Hash(name, seed);
+            }
+
+            seed = Utils::Hash(names->size(), seed);
+        }
+
+        return seed;
+    }
+
+    void GenerateForwardDeclarations(TextBuffer& stream, const FHeaderDependencies& dependencies)
+    {
+        if (!dependencies.Classes.empty() || !dependencies.Enums.empty())
+        {
+            Printer::Section(stream, "Forward Declarations");
+
+            for (const std::string& className : dependencies.Classes)
+            {
+                stream << "class " << className << ";\n";
+            }
+
+            for (const std::string& enumName : dependencies.Enums)
+            {
+                stream << "enum class " << enumName << " : " << GConfig::GetEnumClassType() << ";\n";
+            }
+
+            stream << "\n";
+        }
+    }
+
+    // Anything global that changes the generated code, if any of this is different every package has to be generated again.
+    uint64_t CreateSettingsFingerprint()
+    {
+        uint64_t fingerprint = Utils::Hash(GEngine::GetName());
+        fingerprint = Utils::Hash(GEngine::GetVersion(), fingerprint);
+        fingerprint = Utils::Hash(GEngine::GetCredits(), fingerprint);
+        fingerprint = Utils::Hash(GEngine::GetLinks(), fingerprint);
+        fingerprint = Utils::Hash(static_cast<uint64_t>(FINGERPRINT_VERSION), fingerprint);
+        fingerprint = Utils::Hash(GConfig::GetGameNameLong(), fingerprint);
+        fingerprint = Utils::Hash(GConfig::GetGameNameShort(), fingerprint);
+        fingerprint = Utils::Hash(GConfig::GetGameVersion(), fingerprint);
+        fingerprint = Utils::Hash(GConfig::GetEnumClassType(), fingerprint);
+        fingerprint = Utils::Hash(GConfig::GetConstSpacing(), fingerprint);
+        fingerprint = Utils::Hash(GConfig::GetCommentSpacing(), fingerprint);
+        fingerprint = Utils::Hash(GConfig::GetEnumSpacing(), fingerprint);
+        fingerprint = Utils::Hash(GConfig::GetClassSpacing(), fingerprint);
+        fingerprint = Utils::Hash(GConfig::GetStructSpacing(), fingerprint);
+        fingerprint = Utils::Hash(GConfig::GetFunctionSpacing(), fingerprint);
+        fingerprint = Utils::Hash(GConfig::UsingWindows(), fingerprint);
+        fingerprint = Utils::Hash(GConfig::UsingConstants(), fingerprint);
+        fingerprint = Utils::Hash(GConfig::RemoveNativeIndex(), fingerprint);
+        fingerprint = Utils::Hash(GConfig::RemoveNativeFlags(), fingerprint);
+        fingerprint = Utils::Hash(GConfig::PrintEnumFlags(), fingerprint);
+        fingerprint = Utils::Hash(GConfig::UsingEnumClasses(), fingerprint);
+        fingerprint = Utils::Hash(GConfig::GetGameAlignment(), fingerprint);
+        fingerprint = Utils::Hash(GConfig::GetFinalAlignment(), fingerprint);
+        fingerprint = Utils::Hash(GConfig::UsingProcessEventIndex(), fingerprint);
+        fingerprint = Utils::Hash(static_cast<uint64_t>(GConfig::GetProcessEventIndex()), fingerprint);
+        fingerprint = Utils::Hash(GConfig::UsingOffsets(), fingerprint);
+        fingerprint = Utils::Hash(GConfig::AmalgamatingHeaders(), fingerprint);
+        fingerprint = Utils::Hash(GConfig::GetFunctionChunkSize(), fingerprint);
+        return fingerprint;
+    }
+
+    // Classes and structs include their super's name and size, so packages that inherit from a type whose layout moved get a new fingerprint too.
+    uint64_t CreatePackageFingerprint(const UnrealObject& packageObj, uint64_t settingsFingerprint)
+    {
+        uint64_t fingerprint = Utils::Hash(packageObj.ValidName, settingsFingerprint);
+
+        for (EClassTypes classType : { EClassTypes::UConst, EClassTypes::UEnum, EClassTypes::UClass })
+        {
+            std::vector<UnrealObject>* objCache = GCache::GetCache(packageObj.Object, classType);
+
+            if (objCache)
+            {
+                for (const UnrealObject& unrealObj : *objCache)
+                {
+                    fingerprint = GCache::GetFingerprint(unrealObj, fingerprint);
+                }
+            }
+        }
+
+        // Structs are fingerprinted from the plan instead of the cache, it also has the structs from other packages that get generated in this one.
+        const std::vector<UnrealObject>* structPlan = StructGenerator::GetPlan(packageObj.Object);
+
+        if (structPlan)
+        {
+            for (const UnrealObject& unrealObj : *structPlan)
+            {
+                fingerprint = GCache::GetFingerprint(unrealObj, fingerprint);
+            }
+        }
+
+        // Classes are already covered by the cache, but the order they're generated in is part of the output too.
+        const std::vector<UnrealObject>* classPlan = ClassGenerator::GetPlan(packageObj.Object);
+
+        if (classPlan)
+        {
+            for (const UnrealObject& unrealObj : *classPlan)
+            {
+                fingerprint = Utils::Hash(unrealObj.FullName, fingerprint);
+
+                // Where process event is in the vftable can change with a game update without the class itself changing.
+                if (unrealObj.Object == UObject::StaticClass())
+                {
+                    fingerprint = FunctionGenerator::HashVirtualFunctions(fingerprint);
+                }
+            }
+        }
+
+        return fingerprint;
+    }
+
+    void LoadFingerprints()
+    {
+        m_previousFingerprints.clear();
+        m_previousFunctionFiles.clear();
+        m_fingerprints.clear();
+        m_functionFiles.clear();
+
+        std::ifstream file(GConfig::GetOutputPath() / GConfig::GetGameNameShort() / "PackageManifest.txt");
+        uint64_t fingerprint = 0;
+        uint32_t functionFiles = 0;
+        std::string packageName;
+
+        while (file >> fingerprint >> functionFiles >> packageName)
+        {
+            m_previousFingerprints[packageName] = fingerprint;
+            m_previousFunctionFiles[packageName] = functionFiles;
+        }
+    }
+
+    void SaveFingerprints()
+    {
+        TextBuffer buffer;
+
+        for (const auto& fingerprintPair : m_fingerprints)
+        {
+            buffer << fingerprintPair.second << " " << m_functionFiles[fingerprintPair.first] << " " << fingerprintPair.first << "\n";
+        }
+
+        std::ofstream file(GConfig::GetOutputPath() / GConfig::GetGameNameShort() / "PackageManifest.txt");
+        file << buffer;
+
+        m_previousFingerprints.clear();
+        m_previousFunctionFiles.clear();
+        m_fingerprints.clear();
+        m_functionFiles.clear();
+    }
+
+    std::string GetFunctionFile(const std::string& packageName, uint32_t chunkIndex, uint32_t chunkCount)
+    {
+        if (chunkCount > 1)
+        {
+            Printer::NumberBuffer numberBuffer;
+            return (packageName + "_classes_").append(Printer::Decimal(numberBuffer, (chunkIndex + 1), 2)).append(".cpp");
+        }
+
+        return (packageName + "_classes.cpp");
+    }
+
+    // Classes are never split between chunks, each chunk is filled up to an even share of the package so the last one isn't left with scraps.
+    uint32_t ProcessFunctionChunks(const std::filesystem::path& directory, const UnrealObject& packageObj, const std::set<std::string>& includes)
+    {
+        std::vector<TextBuffer> classStreams;
+        FunctionGenerator::ProcessFunctions(classStreams, packageObj.Object);
+
+        size_t totalSize = 0;
+
+        for (const TextBuffer& classStream : classStreams)
+        {
+            totalSize += classStream.size();
+        }
+
+        size_t chunkSize = GConfig::GetFunctionChunkSize();
+        uint32_t chunkCount = 1;
+
+        if ((chunkSize > 0) && (totalSize > chunkSize))
+        {
+            chunkCount = static_cast<uint32_t>((totalSize + chunkSize - 1) / chunkSize);
+            chunkSize = ((totalSize + chunkCount - 1) / chunkCount);
+        }
+
+        std::vector<TextBuffer> chunks(1);
+
+        for (const TextBuffer& classStream : classStreams)
+        {
+            if (!chunks.back().empty() && (chunks.size() < chunkCount) && ((chunks.back().size() + classStream.size()) > chunkSize))
+            {
+                chunks.emplace_back();
+            }
+
+            chunks.back() << classStream;
+        }
+
+        chunkCount = static_cast<uint32_t>(chunks.size());
+
+        for (uint32_t chunkIndex = 0; chunkIndex < chunkCount; chunkIndex++)
+        {
+            std::string fileName = GetFunctionFile(packageObj.ValidName, chunkIndex, chunkCount);
+            TextBuffer file;
+
+            Printer::Header(file, fileName.substr(0, fileName.rfind('.')), "cpp", true, includes);
+            Printer::Section(file, "Functions");
+            file << chunks[chunkIndex];
+            Printer::Footer(file, true);
+            GWriter::Write((directory / fileName), file.release());
+        }
+
+        // Chunks from a previous run with a bigger split would otherwise get compiled along with the new ones.
+        std::error_code removeError;
+
+        if (chunkCount > 1)
+        {
+            std::filesystem::remove((directory / GetFunctionFile(packageObj.ValidName, 0, 1)), removeError);
+        }
+
+        uint32_t staleIndex = ((chunkCount > 1) ? chunkCount : 0);
+
+        while (std::filesystem::remove((directory / GetFunctionFile(packageObj.ValidName, staleIndex, UINT32_MAX)), removeError)) // Any count above one gives the chunk name.
+        {
+            staleIndex++;
+        }
+
+        return chunkCount;
+    }
+
+    void ProcessPackage(const std::filesystem::path& directory, const UnrealObject& packageObj)
+    {
+#ifndef NO_LOGGING
+        GLogger::Log("\nProcessing Package: " + packageObj.ValidName + "\n");
+#endif
+
+        static const FPackageDependencies noDependencies;
+        auto dependencyIt = m_dependencies.find(packageObj.Object);
+        const FPackageDependencies& dependencies = ((dependencyIt != m_dependencies.end()) ? dependencyIt->second : noDependencies);
+        TextBuffer file;
+
+        // Structs
+        Printer::Header(file, (packageObj.ValidName + "_structs"), "hpp", true, dependencies.Structs.Includes);
+        GenerateForwardDeclarations(file, dependencies.Structs);
+        Printer::Section(file, "Structs");
+        StructGenerator::ProcessStructs(file, packageObj.Object);
+        Printer::Footer(file, true);
+        GWriter::Write((directory / (packageObj.ValidName + "_structs.hpp")), file.release());
+
+        // Classes
+        Printer::Header(file, (packageObj.ValidName + "_classes"), "hpp", true, dependencies.Classes.Includes);
+        GenerateForwardDeclarations(file, dependencies.Classes);
+        Printer::Section(file, "Constants");
+        ConstGenerator::ProcessConsts(file, packageObj.Object);
+        Printer::Section(file, "Enums");
+        EnumGenerator::ProcessEnums(file, packageObj.Object);
+        Printer::Section(file, "Classes");
+        ClassGenerator::ProcessClasses(file, packageObj.Object);
+        Printer::Footer(file, true);
+        GWriter::Write((directory / (packageObj.ValidName + "_classes.hpp")), file.release());
+
+        // Parameters
+        Printer::Header(file, (packageObj.ValidName + "_parameters"), "hpp", true, dependencies.Parameters.Includes);
+        GenerateForwardDeclarations(file, dependencies.Parameters);
+        Printer::Section(file, "Parameters");
+        ParameterGenerator::ProcessParameters(file, packageObj.Object);
+        Printer::Footer(file, true);
+        GWriter::Write((directory / (packageObj.ValidName + "_parameters.hpp")), file.release());
+
+        // Functions, the amalgamated "SdkHeaders.hpp" already has everything so it's included instead of the package headers it was made from.
+        std::set<std::string> functionIncludes;
+
+        if (!GConfig::AmalgamatingHeaders())
+        {
+            functionIncludes = { (packageObj.ValidName + "_classes.hpp"), (packageObj.ValidName + "_parameters.hpp") };
+        }
+
+        uint32_t functionFiles = ProcessFunctionChunks(directory, packageObj, functionIncludes);
+        auto functionFilesIt = m_functionFiles.find(packageObj.ValidName); // Already added for every package before any of them are processed, so this never changes the map itself.
+
+        if (functionFilesIt != m_functionFiles.end())
+        {
+            functionFilesIt->second = functionFiles;
+        }
     }
 
     void ProcessPackages(const std::filesystem::path& directory)
     {
         if (std::filesystem::exists(directory))
         {
-            std::vector<UnrealObject>* packages = GCache::GetPackages();
+            PlanPackages();
 
-            for (const UnrealObject& packageObj : *packages)
+            std::vector<UnrealObject> packages;
+
+            for (const UnrealObject& packageObj : *GCache::GetPackages())
             {
                 if (packageObj.IsValid())
                 {
+                    packages.push_back(packageObj);
+                }
+            }
+
+            uint64_t settingsFingerprint = CreateSettingsFingerprint();
+            std::vector<uint64_t> fingerprints(packages.size());
+            GScheduler::Start(Utils::GetThreadCount());
+
+            m_dependencies.clear();
+
+            for (const UnrealObject& packageObj : packages)
+            {
+                m_dependencies[packageObj.Object] = FPackageDependencies(); // Added up front so the map isn't changed while workers are filling them in.
+            }
+
+            GScheduler::ParallelFor(packages.size(), [&](size_t packageIndex)
+            {
+                FPackageDependencies& dependencies = m_dependencies.find(packages[packageIndex].Object)->second;
+                dependencies = CreateDependencies(packages[packageIndex]);
+
+                uint64_t fingerprint = CreatePackageFingerprint(packages[packageIndex], settingsFingerprint);
+                fingerprint = HashDependencies(dependencies.Structs, fingerprint);
+                fingerprint = HashDependencies(dependencies.Classes, fingerprint);
+                fingerprints[packageIndex] = HashDependencies(dependencies.Parameters, fingerprint);
+            });
+
+            // Packages are only skipped if nothing about them changed since last time, and all of their files are still there and haven't been edited.
+            std::vector<UnrealObject> changedPackages;
+
+            for (size_t packageIndex = 0; packageIndex < packages.size(); packageIndex++)
+            {
+                const UnrealObject& packageObj = packages[packageIndex];
+                auto previousIt = m_previousFingerprints.find(packageObj.ValidName);
+                auto previousFilesIt = m_previousFunctionFiles.find(packageObj.ValidName);
+                uint32_t functionFiles = ((previousFilesIt != m_previousFunctionFiles.end()) ? previousFilesIt->second : 0);
+                m_fingerprints[packageObj.ValidName] = fingerprints[packageIndex];
+                m_functionFiles[packageObj.ValidName] = functionFiles;
+
+                bool bFilesExist = ((functionFiles > 0)
+                    && GWriter::IsIntact(directory / (packageObj.ValidName + "_structs.hpp"))
+                    && GWriter::IsIntact(directory / (packageObj.ValidName + "_classes.hpp"))
+                    && GWriter::IsIntact(directory / (packageObj.ValidName + "_parameters.hpp")));
+
+                for (uint32_t chunkIndex = 0; bFilesExist && (chunkIndex < functionFiles); chunkIndex++)
+                {
+                    bFilesExist = GWriter::IsIntact(directory / GetFunctionFile(packageObj.ValidName, chunkIndex, functionFiles));
+                }
+
+                if ((previousIt == m_previousFingerprints.end()) || (previousIt->second != fingerprints[packageIndex]) || !bFilesExist)
+                {
+                    changedPackages.push_back(packageObj);
+                }
+            }
+
 #ifndef NO_LOGGING
-                    GLogger::Log("\nProcessing Package: " + packageObj.ValidName + "\n");
+            GLogger::Log("\nSkipping " + std::to_string(packages.size() - changedPackages.size()) + " unchanged packages, generating " + std::to_string(changedPackages.size()) + ".");
 #endif
 
-                    std::ofstream file;
-
-                    // Structs
-                    file.open(directory / (packageObj.ValidName + "_structs.hpp"));
-                    Printer::Header(file, (packageObj.ValidName + "_structs"), "hpp", true);
-                    Printer::Section(file, "Structs");
-                    StructGenerator::ProcessStructs(file, packageObj.Object);
-                    Printer::Footer(file, true);
-                    file.close();
-
-                    // Classes
-                    file.open(directory / (packageObj.ValidName + "_classes.hpp"));
-                    Printer::Header(file, (packageObj.ValidName + "_classes"), "hpp", true);
-                    Printer::Section(file, "Constants");
-                    ConstGenerator::ProcessConsts(file, packageObj.Object);
-                    Printer::Section(file, "Enums");
-                    EnumGenerator::ProcessEnums(file, packageObj.Object);
-                    Printer::Section(file, "Classes");
-                    ClassGenerator::ProcessClasses(file, packageObj.Object);
-                    Printer::Footer(file, true);
-                    file.close();
-
-                    // Parameters
-                    file.open(directory / (packageObj.ValidName + "_parameters.hpp"));
-                    Printer::Header(file, (packageObj.ValidName + "_parameters"), "hpp", true);
-                    Printer::Section(file, "Parameters");
-                    ParameterGenerator::ProcessParameters(file, packageObj.Object);
-                    Printer::Footer(file, true);
-                    file.close();
-
-                    // Functions
-                    file.open(directory / (packageObj.ValidName + "_classes.cpp"));
-                    Printer::Header(file, (packageObj.ValidName + "_classes"), "cpp", true);
-                    Printer::Section(file, "Functions");
-                    FunctionGenerator::ProcessFunctions(file, packageObj.Object);
-                    Printer::Footer(file, true);
-                    file.close();
-                }
+            // Each package is logged into its own buffer, which are written to the log file in package order once every package is done.
+            std::vector<std::string> packageLogs(changedPackages.size());
+
+            GScheduler::ParallelFor(changedPackages.size(), [&](size_t packageIndex)
+            {
+                std::string* previousLog = GLogger::Redirect(&packageLogs[packageIndex]);
+                ProcessPackage(directory, changedPackages[packageIndex]);
+                GLogger::Redirect(previousLog);
+            });
+
+            GScheduler::Stop();
+
+            for (const std::string& packageLog : packageLogs)
+            {
+                GLogger::Write(packageLog);
             }
         }
         else
@@ -3541,8 +4985,9 @@ namespace Generator
         }
     }
 
-    void GenerateSDK()
+    bool GenerateSDK()
     {
+        bool bGenerated = false;
         std::filesystem::path fullDirectory = (GConfig::GetOutputPath() / GConfig::GetGameNameShort());
         std::filesystem::path headerDirectory = (fullDirectory / "SDK_HEADERS");
 
@@ -3556,11 +5001,55 @@ namespace Generator
             {
                 Utils::MessageboxInfo("SDK generation has started, do not close the game until prompted to do so!");
                 std::chrono::time_point startTime = std::chrono::system_clock::now();
+                GWriter::Start(fullDirectory / "SdkManifest.txt");
+                LoadFingerprints();
 
                 ProcessPackages(headerDirectory);
                 GenerateHeaders();
+                GenerateUnityFiles();
                 GenerateDefines();
+
+#ifndef NO_LOGGING
+                std::chrono::time_point constantsTime = std::chrono::system_clock::now();
+#endif
+
                 GenerateConstants();
+
+#ifndef NO_LOGGING
+                if (GConfig::UsingConstants())
+                {
+                    GLogger::Log("\nConstants generated in " + Printer::Precision(std::chrono::duration<float>(std::chrono::system_clock::now() - constantsTime).count(), 4) + " seconds.");
+                }
+#endif
+
+                GWriter::Stop(); // Waits for the last of the files to finish writing.
+
+#ifndef NO_LOGGING
+                GLogger::Log("\nWrote " + std::to_string(GWriter::GetFilesWritten()) + " files (" + std::to_string(GWriter::GetBytesWritten()) + " bytes), peak write queue depth " + std::to_string(GWriter::GetPeakDepth()) + "/" + std::to_string(GWriter::GetMaxDepth()) + ".");
+                GLogger::Log(std::to_string(GWriter::GetFilesUnchanged()) + " files were unchanged and left untouched.");
+
+                for (const std::string& changedFile : GWriter::GetChangedFiles())
+                {
+                    GLogger::Log("Changed: " + changedFile);
+                }
+#endif
+
+                if (GWriter::GetFilesFailed() == 0)
+                {
+                    SaveFingerprints();
+                    bGenerated = true;
+                }
+                else
+                {
+                    std::error_code removeError;
+                    std::filesystem::remove((fullDirectory / "PackageManifest.txt"), removeError); // Can't tell which packages failed, so they all get generated next time.
+
+#ifndef NO_LOGGING
+                    GLogger::Log("Error: Failed to write " + std::to_string(GWriter::GetFilesFailed()) + " files!");
+#endif
+                    Utils::MessageboxError("Error: Failed to write " + std::to_string(GWriter::GetFilesFailed()) + " sdk files, might not have the right permissions or your directory is invalid!");
+                }
+
                 GCache::ClearCache();
 
                 std::chrono::time_point endTime = std::chrono::system_clock::now();
@@ -3578,30 +5067,118 @@ namespace Generator
         {
             Utils::MessageboxError("Failed to create the desired directory, cannot generate an SDK!");
         }
+
+        return bGenerated;
     }
 
-    bool Initialize(bool bCreateLog)
+    bool GenerateSnapshotSDK(const std::filesystem::path& file)
     {
-        if (!GConfig::HasOutputPath())
+        if (Snapshot::Load(file))
         {
-            Utils::MessageboxError("Looks like you forgot to set an output path for the generator! Please edit the output path in \"Configuration.cpp\" and recompile.");
-            return false;
+            return GenerateSDK();
         }
 
-        if (!AreGlobalsValid())
+        return false;
+    }
+
+    void CaptureSnapshot()
+    {
+        if (GConfig::HasOutputPath() && FindGlobals())
         {
-            if (GConfig::UsingOffsets())
+            std::filesystem::path fullDirectory = (GConfig::GetOutputPath() / GConfig::GetGameNameShort());
+            std::filesystem::create_directory(GConfig::GetOutputPath());
+            std::filesystem::create_directory(fullDirectory);
+
+            if (std::filesystem::exists(fullDirectory))
             {
-                GObjects = reinterpret_cast<TArray<UObject*>*>(Retrievers::GetBaseAddress() + GConfig::GetGObjectOffset());
-                GNames = reinterpret_cast<TArray<FNameEntry*>*>(Retrievers::GetBaseAddress() + GConfig::GetGNameOffset());
+                std::chrono::time_point startTime = std::chrono::system_clock::now();
+
+                if (Snapshot::Capture(fullDirectory / "Snapshot.bin"))
+                {
+                    std::string formattedTime = Printer::Precision(std::chrono::duration<float>(std::chrono::system_clock::now() - startTime).count(), 4);
+                    Utils::MessageboxInfo("Snapshot captured in " + formattedTime + " seconds, you can now close the game and generate from it!");
+                }
             }
-            else
+        }
+        else
+        {
+            Utils::MessageboxError("Failed to validate GObject & GNames, cannot capture a snapshot!");
+        }
+    }
+
+    // Every pattern that's needed is found in a single pass over the module, any other signatures should be added to the same list instead of scanning for them separately.
+    bool FindGlobals()
+    {
+        if (!Snapshot::IsLoaded()) // There's no game to look in when generating offline, a loaded snapshot is all there is.
+        {
+            std::vector<Scanner::FPattern> patterns;
+            bool bScanGlobals = false;
+            bool bScanProcessEvent = (!m_processEvent && !GConfig::UsingProcessEventIndex());
+
+            if (!AreGlobalsValid())
+            {
+                if (GConfig::UsingOffsets())
+                {
+                    GObjects = reinterpret_cast<TArray<UObject*>*>(Retrievers::GetBaseAddress() + GConfig::GetGObjectOffset());
+                    GNames = reinterpret_cast<TArray<FNameEntry*>*>(Retrievers::GetBaseAddress() + GConfig::GetGNameOffset());
+                }
+                else
+                {
+                    patterns.push_back(Retrievers::CreatePattern(GConfig::GetGObjectSignature(), GConfig::GetGObjectPattern(), GConfig::GetGObjectMask(), Scanner::ESectionType::Data));
+                    patterns.push_back(Retrievers::CreatePattern(GConfig::GetGNameSignature(), GConfig::GetGNamePattern(), GConfig::GetGNameMask(), Scanner::ESectionType::Data));
+                    bScanGlobals = true;
+                }
+            }
+
+            if (bScanProcessEvent)
             {
-                GObjects = reinterpret_cast<TArray<UObject*>*>(Retrievers::FindPattern(GConfig::GetGObjectPattern(), GConfig::GetGObjectMask()));
-                GNames = reinterpret_cast<TArray<FNameEntry*>*>(Retrievers::FindPattern(GConfig::GetGNamePattern(), GConfig::GetGNameMask()));
+                patterns.push_back(Retrievers::CreatePattern(GConfig::GetProcessEventSignature(), GConfig::GetProcessEventPattern(), GConfig::GetProcessEventMask(), Scanner::ESectionType::Code));
             }
 
-            if (AreGlobalsValid())
+            if (!patterns.empty())
+            {
+                std::vector<uintptr_t> addresses = Retrievers::FindPatterns(patterns, true);
+
+                if (bScanGlobals)
+                {
+                    GObjects = reinterpret_cast<TArray<UObject*>*>(Retrievers::ResolveSignature(addresses[0], GConfig::GetGObjectSignature()));
+                    GNames = reinterpret_cast<TArray<FNameEntry*>*>(Retrievers::ResolveSignature(addresses[1], GConfig::GetGNameSignature()));
+
+                    if (!AreGlobalsValid())
+                    {
+                        addresses = Retrievers::FindPatterns(patterns, false); // In case a cached offset was stale, skip the cache and scan the whole module again.
+                        GObjects = reinterpret_cast<TArray<UObject*>*>(Retrievers::ResolveSignature(addresses[0], GConfig::GetGObjectSignature()));
+                        GNames = reinterpret_cast<TArray<FNameEntry*>*>(Retrievers::ResolveSignature(addresses[1], GConfig::GetGNameSignature()));
+                    }
+                }
+
+                if (bScanProcessEvent)
+                {
+                    m_processEvent = Retrievers::ResolveSignature(addresses.back(), GConfig::GetProcessEventSignature());
+                }
+            }
+        }
+
+        return AreGlobalsValid();
+    }
+
+    uintptr_t GetProcessEvent()
+    {
+        return m_processEvent;
+    }
+
+    bool Initialize(bool bCreateLog)
+    {
+        if (!GConfig::HasOutputPath())
+        {
+            Utils::MessageboxError("Looks like you forgot to set an output path for the generator! Please edit the output path in \"Configuration.cpp\" and recompile.");
+            return false;
+        }
+
+        // Globals can either be found in game here, or already be set by a loaded snapshot, either way members and the cache only need to be set up once.
+        if (FindGlobals())
+        {
+            if (!m_initialized)
             {
                 // Here is where that "REGISTER_MEMBER" macro is used, these functions calculate offsets for each class member.
                 // There might be a better and automated way of doing this, so maybe I'll change this in the future when I'm less lazy.
@@ -3657,33 +5234,31 @@ namespace Generator
 
                 if (bCreateLog && GLogger::Open())
                 {
-                    GLogger::Log("Base: " + Printer::Hex(Retrievers::GetBaseAddress(), sizeof(uintptr_t)));
-                    GLogger::Log("GObjects: " + Printer::Hex(GObjects));
-                    GLogger::Log("GNames: " + Printer::Hex(GNames));
+                    Printer::NumberBuffer numberBuffer;
+                    GLogger::Log(std::string("Base: ").append(Printer::Hex(numberBuffer, Retrievers::GetBaseAddress(), sizeof(uintptr_t))));
+                    GLogger::Log(std::string("GObjects: ").append(Printer::Hex(numberBuffer, GObjects)));
+                    GLogger::Log(std::string("GNames: ").append(Printer::Hex(numberBuffer, GNames)));
                     GLogger::Log("\n" + GConfig::GetGameNameShort() + " objects cached in " + formattedTime + " seconds.");
+                    GLogger::Log("Scanned " + std::to_string(UObject::GObjObjects()->size()) + " GObjects, cached " + std::to_string(GCache::GetObjectCount()) + " objects from " + std::to_string(GCache::GetPackages()->size()) + " packages.");
                 }
 #endif
+
+                m_initialized = true;
             }
-            else
-            {
-                Utils::MessageboxError("Failed to validate GObject & GNames, please make sure you have them configured properly in \"Configuration.cpp\"!");
-                return false;
-            }
-        }
 
-        if (AreGlobalsValid())
-        {
 #ifndef NO_LOGGING
             if (bCreateLog && GLogger::Open()) // Will return false if the file is already open.
             {
-                GLogger::Log("Base: " + Printer::Hex(Retrievers::GetBaseAddress(), sizeof(uintptr_t)));
-                GLogger::Log("GObjects: " + Printer::Hex(GObjects));
-                GLogger::Log("GNames: " + Printer::Hex(GNames));
+                Printer::NumberBuffer numberBuffer;
+                GLogger::Log(std::string("Base: ").append(Printer::Hex(numberBuffer, Retrievers::GetBaseAddress(), sizeof(uintptr_t))));
+                GLogger::Log(std::string("GObjects: ").append(Printer::Hex(numberBuffer, GObjects)));
+                GLogger::Log(std::string("GNames: ").append(Printer::Hex(numberBuffer, GNames)));
             }
 #endif
             return true;
         }
 
+        Utils::MessageboxError("Failed to validate GObject & GNames, please make sure you have them configured properly in \"Configuration.cpp\"!");
         return false;
     }
 
@@ -3715,10 +5290,11 @@ namespace Generator
 
             if (std::filesystem::exists(fullDirectory))
             {
-                std::ofstream file(fullDirectory / "NameDump.txt");
-                file << "Base: " << Printer::Hex(Retrievers::GetBaseAddress(), sizeof(uintptr_t)) << "\n";
-                file << "GNames: " << Printer::Hex(GNames) << "\n";
-                file << "Offset: " << Printer::Hex(Retrievers::GetOffset(GNames), sizeof(uintptr_t)) << "\n" << std::endl;
+                TextBuffer file;
+                Printer::NumberBuffer numberBuffer;
+                file << "Base: " << Printer::Hex(numberBuffer, Retrievers::GetBaseAddress(), sizeof(uintptr_t)) << "\n";
+                file << "GNames: " << Printer::Hex(numberBuffer, GNames) << "\n";
+                file << "Offset: " << Printer::Hex(numberBuffer, Retrievers::GetOffset(GNames), sizeof(uintptr_t)) << "\n\n";
 
                 for (int32_t i = 0; i < FName::Names()->size(); i++)
                 {
@@ -3726,7 +5302,7 @@ namespace Generator
 
                     if (nameEntry)
                     {
-                        std::string name = nameEntry->ToString();
+                        std::string_view name = nameEntry->ToStringView();
 
                         if (!name.empty())
                         {
@@ -3739,12 +5315,12 @@ namespace Generator
                                 Printer::FillRight(file, ' ', (INSTANCE_DUMP_SPACING - name.length()));
                             }
 
-                            file << Printer::Hex(nameEntry) << "\n";
+                            file << Printer::Hex(numberBuffer, nameEntry) << "\n";
                         }
                     }
                 }
 
-                file.close();
+                GWriter::Write((fullDirectory / "NameDump.txt"), file.release());
             }
         }
     }
@@ -3759,10 +5335,11 @@ namespace Generator
 
             if (std::filesystem::exists(fullDirectory))
             {
-                std::ofstream file(fullDirectory / "ObjectDump.txt");
-                file << "Base: " << Printer::Hex(Retrievers::GetBaseAddress(), sizeof(uintptr_t)) << "\n";
-                file << "GObjects: " << Printer::Hex(GObjects) << "\n";
-                file << "Offset: " << Printer::Hex(Retrievers::GetOffset(GObjects), sizeof(uintptr_t)) << "\n" << std::endl;
+                TextBuffer file;
+                Printer::NumberBuffer numberBuffer;
+                file << "Base: " << Printer::Hex(numberBuffer, Retrievers::GetBaseAddress(), sizeof(uintptr_t)) << "\n";
+                file << "GObjects: " << Printer::Hex(numberBuffer, GObjects) << "\n";
+                file << "Offset: " << Printer::Hex(numberBuffer, Retrievers::GetOffset(GObjects), sizeof(uintptr_t)) << "\n\n";
 
                 for (int32_t i = 0; i < (UObject::GObjObjects()->size() - 1); i++)
                 {
@@ -3770,7 +5347,7 @@ namespace Generator
 
                     if (uObject)
                     {
-                        std::string name = uObject->GetFullName();
+                        std::string name = GCache::GetFullName(uObject);
 
                         if (!name.empty())
                         {
@@ -3783,12 +5360,12 @@ namespace Generator
                                 Printer::FillRight(file, ' ', (INSTANCE_DUMP_SPACING - name.length()));
                             }
 
-                            file << Printer::Hex(uObject) << "\n";
+                            file << Printer::Hex(numberBuffer, uObject) << "\n";
                         }
                     }
                 }
 
-                file.close();
+                GWriter::Write((fullDirectory / "ObjectDump.txt"), file.release());
             }
         }
     }
@@ -3830,11 +5407,20 @@ namespace Generator
     }
 }
 
+#ifdef _WIN32
 void OnAttach(HMODULE hModule)
 {
     DisableThreadLibraryCalls(hModule);
-    Generator::GenerateSDK();
-    Generator::DumpInstances(true, true);
+
+    if (GConfig::CapturingSnapshot())
+    {
+        Generator::CaptureSnapshot();
+    }
+    else
+    {
+        Generator::GenerateSDK();
+        Generator::DumpInstances(true, true);
+    }
 }
 
 BOOL APIENTRY DllMain(HMODULE hModule, DWORD ul_reason_for_call, LPVOID lpReserved)
@@ -3850,4 +5436,5 @@ BOOL APIENTRY DllMain(HMODULE hModule, DWORD ul_reason_for_call, LPVOID lpReserv
         break;
     }
     return TRUE;
-}
\ No newline at end of file
+}
+#endif
\ No newline at end of file
@@ -1,6 +1,10 @@
 #pragma once
 #include "pch.hpp"
 #include "Framework/Printer.hpp"
+#include "Framework/Scanner.hpp"
+#include "Framework/Snapshot.hpp"
+#include "Framework/Scheduler.hpp"
+#include "Framework/Writer.hpp"
 #include "Engine/Engine.hpp"
 
 class UnrealObject
@@ -16,28 +20,33 @@ public:
 	std::string FullName;
 	std::string ValidName;
 
+private:
+	uint64_t m_hash; // Precomputed from the type and names, so comparisons and hashing never need to build a string.
+
 public:
 	UnrealObject();
-	UnrealObject(class UObject* uObject, bool bIsPackage = false);
+	UnrealObject(class UObject* uObject, bool bIsPackage = false, bool bDeferName = false);
 	UnrealObject(const UnrealObject& unrealObj);
 	~UnrealObject();
 
 public:
 	bool IsValid() const;
-	std::string Hash() const;
+	uint64_t Hash() const;
+	void ResolveName();
 	static void ValidateName(std::string& name);
 	static std::string CreateValidName(std::string name);
 
 private:
-	void Assign(class UObject* uObject, bool bIsPackage);
+	void Assign(class UObject* uObject, bool bIsPackage, bool bDeferName);
 	void AssignType();
-	void AssignName();
+	void AssignName(bool bDeferName);
+	void AssignHash();
 
 public:
-	bool operator>(const UnrealObject& unrealObj);
-	bool operator<(const UnrealObject& unrealObj);
-	bool operator==(const UnrealObject& unrealObj);
-	bool operator!=(const UnrealObject& unrealObj);
+	bool operator>(const UnrealObject& unrealObj) const;
+	bool operator<(const UnrealObject& unrealObj) const;
+	bool operator==(const UnrealObject& unrealObj) const;
+	bool operator!=(const UnrealObject& unrealObj) const;
 	UnrealObject& operator=(const UnrealObject& unrealObj);
 };
 
@@ -48,6 +57,9 @@ public:
 	class UProperty* Property;
 	std::string ValidName;
 
+private:
+	uint64_t m_hash; // Property pointer and type packed together.
+
 public:
 	UnrealProperty();
 	UnrealProperty(class UProperty* uProperty);
@@ -56,7 +68,7 @@ public:
 
 public:
 	bool IsValid() const;
-	std::string Hash() const;
+	uint64_t Hash() const;
 
 public:
 	bool IsContainer() const;
@@ -82,12 +94,13 @@ private:
 	void Assign(class UProperty* uProperty);
 	void AssignType();
 	void AssignName();
+	void AssignHash();
 
 public:
-	bool operator>(const UnrealProperty& unrealProp);
-	bool operator<(const UnrealProperty& unrealProp);
-	bool operator==(const UnrealProperty& unrealProp);
-	bool operator!=(const UnrealProperty& unrealProp);
+	bool operator>(const UnrealProperty& unrealProp) const;
+	bool operator<(const UnrealProperty& unrealProp) const;
+	bool operator==(const UnrealProperty& unrealProp) const;
+	bool operator!=(const UnrealProperty& unrealProp) const;
 	UnrealProperty& operator=(const UnrealProperty& unrealProp);
 };
 
@@ -98,7 +111,7 @@ namespace std
 	{
 		size_t operator()(const UnrealObject& unrealObj) const
 		{
-			return hash<string>()(unrealObj.Hash());
+			return static_cast<size_t>(unrealObj.Hash());
 		}
 	};
 
@@ -107,11 +120,41 @@ namespace std
 	{
 		size_t operator()(const UnrealProperty& unrealProp) const
 		{
-			return hash<string>()(unrealProp.Hash());
+			return static_cast<size_t>(unrealProp.Hash());
 		}
 	};
 }
 
+// Reflection classes the generator checks objects against, each class in "GCache::m_ancestry" has the bits of itself and all of its super classes.
+enum EAncestryFlags : uint32_t
+{
+	ANCESTRY_None = 0x00000000,
+	ANCESTRY_Field = 0x00000001,
+	ANCESTRY_Enum = 0x00000002,
+	ANCESTRY_Const = 0x00000004,
+	ANCESTRY_Property = 0x00000008,
+	ANCESTRY_Struct = 0x00000010,
+	ANCESTRY_Function = 0x00000020,
+	ANCESTRY_ScriptStruct = 0x00000040,
+	ANCESTRY_State = 0x00000080,
+	ANCESTRY_Class = 0x00000100,
+	ANCESTRY_StructProperty = 0x00000200,
+	ANCESTRY_StrProperty = 0x00000400,
+	ANCESTRY_QWordProperty = 0x00000800,
+	ANCESTRY_SQWordProperty = 0x00001000,
+	ANCESTRY_ObjectProperty = 0x00002000,
+	ANCESTRY_ClassProperty = 0x00004000,
+	ANCESTRY_InterfaceProperty = 0x00008000,
+	ANCESTRY_NameProperty = 0x00010000,
+	ANCESTRY_MapProperty = 0x00020000,
+	ANCESTRY_IntProperty = 0x00040000,
+	ANCESTRY_FloatProperty = 0x00080000,
+	ANCESTRY_DelegateProperty = 0x00100000,
+	ANCESTRY_ByteProperty = 0x00200000,
+	ANCESTRY_BoolProperty = 0x00400000,
+	ANCESTRY_ArrayProperty = 0x00800000
+};
+
 // Caches all need objects and strings for sdk generation, caching is only needed to be done one time on initialization.
 class GCache
 {
@@ -122,7 +165,16 @@ private:
 	static inline std::map<class UObject*, std::vector<UnrealObject>> m_structs;
 	static inline std::map<class UObject*, std::vector<UnrealObject>> m_classes;
 	static inline std::map<std::string, class UObject*> m_constants;
+	static inline std::unordered_map<class UObject*, std::string> m_constantNames; // Reverse of "m_constants", used by "GetConstant".
 	static inline std::vector<UnrealObject> m_packages;
+	static inline std::unordered_set<uint64_t> m_cachedObjects; // Keys of every object in the per package vectors above, so duplicates can be skipped without searching them.
+	static inline std::unordered_set<uint64_t> m_cachedPackages;
+	static inline std::unordered_map<std::string, UnrealObject> m_largestStructs; // Struct full names to the largest struct cached with that name.
+	static inline std::unordered_map<std::string, UnrealObject> m_classNames;
+	static inline std::unordered_set<class UObject*> m_packageObjects;
+	static inline std::unordered_map<class UObject*, std::string> m_outerNames; // Outer objects to their "Outer.Outer.Name" path, shared by every object inside of them.
+	static inline std::shared_mutex m_outerMutex;
+	static inline std::unordered_map<class UClass*, uint32_t> m_ancestry; // Every class with an instance in GObjects to its "EAncestryFlags", built once before the scan.
 
 public:
 	static void Initialize();
@@ -130,27 +182,42 @@ public:
 	static std::vector<UnrealObject>* GetCache(class UObject* packageObj, EClassTypes type);
 	static std::map<std::string, class UObject*>* GetConstants();
 	static std::vector<UnrealObject>* GetPackages();
+	static size_t GetObjectCount();
 
 public:
 	static std::pair<std::string, class UObject*> GetConstant(const UnrealObject& unrealObj);
 	static UnrealObject GetLargestStruct(const std::string& structFullName);
 	static UnrealObject GetClass(const std::string& classFullName);
+	static std::string GetFullName(class UObject* uObject);
+	static uint32_t GetAncestry(class UClass* uClass);
+	static bool IsA(class UObject* uObject, EAncestryFlags ancestryFlag);
+	static uint64_t GetFingerprint(const UnrealObject& unrealObj, uint64_t seed); // Covers everything about an object that changes its generated code, used to skip packages that haven't changed.
 	template<typename T> static uint64_t CountObject(const std::string& objectName)
 	{
 		std::pair<std::string, class UClass*> objectPair{ objectName, T::StaticClass() };
 
-		if (m_objects.contains(objectPair))
+		auto objectIt = m_objects.find(objectPair);
+
+		if (objectIt != m_objects.end())
 		{
-			return m_objects[objectPair];
+			return objectIt->second;
 		}
 
 		return 0;
 	}
 
 private:
+	static uint32_t CreateAncestry(class UClass* uClass);
+	static void CacheAncestry();
+	static void ScanObjects(int32_t startIndex, int32_t endIndex, std::vector<UnrealObject>* bucket);
+	static const std::string& GetOuterName(class UObject* uOuter);
+	static uint64_t CreateKey(const UnrealObject& unrealObj);
 	static void CacheObject(UnrealObject& unrealObj);
 	static void CacheConstant(UnrealObject& unrealObj);
+	static void CacheFullName(UnrealObject& unrealObj);
 	static void CacheCount(UnrealObject& unrealObj);
+	static uint64_t FingerprintStruct(class UStruct* uStruct, uint64_t fingerprint);
+	static uint64_t FingerprintProperty(class UProperty* uProperty, uint64_t fingerprint);
 
 public:
 	GCache() = delete;
@@ -161,13 +228,16 @@ class GLogger
 {
 private:
 	static inline std::ofstream m_file;
+	static inline thread_local std::string* m_buffer = nullptr; // Set while a task is generating on the scheduler, so its log can be written in order afterwards.
 
 public:
 	static bool Open();
 	static void Close();
 	static void Flush();
+	static std::string* Redirect(std::string* buffer);
 
 public:
+	static void Write(const std::string& str, bool bFlush = true);
 	static void Log(const std::string& str, bool bFlush = true);
 	static void LogObject(const std::string& title, const UnrealObject& unrealObj);
 	static void LogClassSize(class UClass* uClass, size_t localSize);
@@ -183,73 +253,129 @@ namespace Utils
 	void MessageboxWarn(const std::string& message);
 	void MessageboxError(const std::string& message);
 
+	uint64_t Hash(const std::string& str, uint64_t seed = 0);
+	uint64_t Hash(uint64_t value, uint64_t seed);
+	uint32_t GetThreadCount();
+
+	void GenerateInOrder(TextBuffer& stream, const std::vector<UnrealObject>& objects, const std::function<void(TextBuffer&, const UnrealObject&)>& generator);
+	void GenerateInOrder(std::vector<TextBuffer>& streams, const std::vector<UnrealObject>& objects, const std::function<void(TextBuffer&, const UnrealObject&)>& generator);
+
 	bool SortProperty(const UnrealProperty& unrealPropA, const UnrealProperty& unrealPropB);
 	bool SortPropertyPair(const std::pair<UnrealProperty, std::string>& pairA, const std::pair<UnrealProperty, std::string>& pairB);
 }
 
 namespace Retrievers
 {
-	void GetAllFunctionFlags(std::ostringstream& stream, uint64_t functionFlags);
-	void GetAllPropertyFlags(std::ostringstream& stream, uint64_t propertyFlags);
-	void GetAllObjectFlags(std::ostringstream& stream, uint64_t objectFlags); // Not currently used by anything, but could be useful in the future.
+	void GetAllFunctionFlags(TextBuffer& stream, uint64_t functionFlags);
+	void GetAllPropertyFlags(TextBuffer& stream, uint64_t propertyFlags);
+	void GetAllObjectFlags(TextBuffer& stream, uint64_t objectFlags); // Not currently used by anything, but could be useful in the future.
 
 	uintptr_t GetBaseAddress();
 	uintptr_t GetOffset(void* pointer);
 	uintptr_t FindPattern(const uint8_t* pattern, const std::string& mask);
+	const uint8_t* GetModuleImage(size_t& imageSize);
+	Scanner::FPattern CreatePattern(const Scanner::FSignature& signature, const uint8_t* pattern, const std::string& mask, Scanner::ESectionType sectionType); // Uses the signature if there is one, otherwise the pattern and mask.
+	uintptr_t ResolveSignature(uintptr_t address, const Scanner::FSignature& signature);
+	uint64_t HashPattern(const Scanner::FPattern& pattern);
+	void LoadSignatureCache(const Scanner::FModuleKey& moduleKey, std::map<uint64_t, uintptr_t>& offsets);
+	void SaveSignatureCache(const Scanner::FModuleKey& moduleKey, const std::map<uint64_t, uintptr_t>& offsets);
+	std::vector<uintptr_t> FindPatterns(const std::vector<Scanner::FPattern>& patterns, bool bUseCache); // Finds them all in one pass, addresses are in the same order as the patterns.
 }
 
 namespace ConstGenerator
 {
 	void GenerateConstName(UnrealObject* unrealObj);
-	void GenerateConst(std::ofstream& stream, const UnrealObject& unrealObj);
-	void ProcessConsts(std::ofstream& stream, class UObject* packageObj);
+	void GenerateConst(TextBuffer& stream, const UnrealObject& unrealObj);
+	void ProcessConsts(TextBuffer& stream, class UObject* packageObj);
 }
 
 namespace EnumGenerator
 {
 	void GenerateEnumName(UnrealObject* unrealObj);
-	void GenerateEnum(std::ofstream& stream, const UnrealObject& unrealObj);
-	void ProcessEnums(std::ofstream& stream, class UObject* packageObj);
+	void GenerateEnum(TextBuffer& stream, const UnrealObject& unrealObj);
+	void ProcessEnums(TextBuffer& stream, class UObject* packageObj);
 }
 
 namespace StructGenerator
 {
-	void GenerateStructMembers(std::ofstream& structStream, EClassTypes type);
-	void GenerateStruct(std::ofstream& stream, const UnrealObject& unrealObj);
-	void GenerateStructPre(std::ofstream& stream, const UnrealObject& unrealObj);
-	void ProcessStructs(std::ofstream& stream, class UObject* packageObj);
+	void GenerateStructMembers(TextBuffer& structStream, EClassTypes type);
+	void GenerateStruct(TextBuffer& stream, const UnrealObject& unrealObj);
+	void PlanStructPre(std::vector<UnrealObject>& plan, const UnrealObject& unrealObj);
+	void PlanStructs(class UObject* packageObj);
+	const std::vector<UnrealObject>* GetPlan(class UObject* packageObj);
+	void ProcessStructs(TextBuffer& stream, class UObject* packageObj);
 }
 
 namespace ClassGenerator
 {
-	void GenerateClassMembers(std::ostringstream& classStream, class UClass* uClass, EClassTypes classType);
-	void GenerateClass(std::ofstream& stream, const UnrealObject& unrealObj);
-	void GenerateClassPre(std::ofstream& stream, const UnrealObject& unrealObj, class UObject* packageObj);
-	void ProcessClasses(std::ofstream& stream, class UObject* packageObj);
+	void GenerateClassMembers(TextBuffer& classStream, class UClass* uClass, EClassTypes classType);
+	void GenerateClass(TextBuffer& stream, const UnrealObject& unrealObj);
+	void PlanClassPre(std::vector<UnrealObject>& plan, const UnrealObject& unrealObj, class UObject* packageObj);
+	void PlanClasses(class UObject* packageObj);
+	const std::vector<UnrealObject>* GetPlan(class UObject* packageObj);
+	void ProcessClasses(TextBuffer& stream, class UObject* packageObj);
 }
 
 namespace ParameterGenerator
 {
-	void GenerateParameter(std::ofstream& stream, const UnrealObject& unrealObj);
-	void ProcessParameters(std::ofstream& stream, class UObject* packageObj);
+	void GenerateParameter(TextBuffer& stream, const UnrealObject& unrealObj);
+	void ProcessParameters(TextBuffer& stream, class UObject* packageObj);
 }
 
 namespace FunctionGenerator
 {
-	void GenerateVirtualFunctions(std::ofstream& stream);
-	void GenerateFunctionCode(std::ofstream& stream, const UnrealObject& unrealObj);
-	void GenerateFunctionParameters(std::ofstream& stream, const UnrealObject& unrealObj);
-	void ProcessFunctions(std::ofstream& stream, class UObject* packageObj);
+	uintptr_t GetProcessEventAddress(); // Null if it couldn't be found, or isn't configured correctly.
+	uint64_t HashVirtualFunctions(uint64_t seed); // Hashes where process event is in UObject's vftable, which is printed by "GenerateVirtualFunctions".
+	void GenerateVirtualFunctions(TextBuffer& stream);
+	void GenerateFunctionCode(TextBuffer& stream, const UnrealObject& unrealObj);
+	void GenerateFunctionParameters(TextBuffer& stream, const UnrealObject& unrealObj);
+	size_t CountFunctions(class UObject* packageObj);
+	void ProcessFunctions(std::vector<TextBuffer>& streams, class UObject* packageObj);
 }
 
+// Everything one package header needs from the rest of the sdk, includes for types used by value and forward declarations for the rest.
+struct FHeaderDependencies
+{
+	std::set<std::string> Includes; // Other package headers, relative to the "SDK_HEADERS" folder.
+	std::set<std::string> Classes;
+	std::set<std::string> Enums;
+};
+
+struct FPackageDependencies
+{
+	FHeaderDependencies Structs;
+	FHeaderDependencies Classes;
+	FHeaderDependencies Parameters;
+};
+
 namespace Generator
 {
 	void GenerateConstants();
+	bool AmalgamateHeader(TextBuffer& stream, const std::filesystem::path& file);
 	void GenerateHeaders();
+	void GenerateUnityFiles();
 	void GenerateDefines();
+	void PlanPackages();
+	void AddInclude(FHeaderDependencies& dependencies, class UObject* packageObj, const std::string& fileSuffix);
+	void AddPropertyDependencies(FHeaderDependencies& dependencies, class UProperty* uProperty, class UObject* packageObj, EClassTypes fileType, bool bByValue);
+	void AddStructDependencies(FHeaderDependencies& dependencies, class UStruct* uStruct, class UObject* packageObj, EClassTypes fileType, bool bByValue);
+	FPackageDependencies CreateDependencies(const UnrealObject& packageObj);
+	uint64_t HashDependencies(const FHeaderDependencies& dependencies, uint64_t seed);
+	void GenerateForwardDeclarations(TextBuffer& stream, const FHeaderDependencies& dependencies);
+	uint64_t CreateSettingsFingerprint();
+	uint64_t CreatePackageFingerprint(const UnrealObject& packageObj, uint64_t settingsFingerprint);
+	void LoadFingerprints();
+	void SaveFingerprints();
+	std::string GetFunctionFile(const std::string& packageName, uint32_t chunkIndex, uint32_t chunkCount);
+	uint32_t ProcessFunctionChunks(const std::filesystem::path& directory, const UnrealObject& packageObj, const std::set<std::string>& includes);
+	void ProcessPackage(const std::filesystem::path& directory, const UnrealObject& packageObj);
 	void ProcessPackages(const std::filesystem::path& directory);
-	void GenerateSDK();
+	bool GenerateSDK(); // Returns false if nothing could be generated, or if any of the files failed to write.
+	bool GenerateSnapshotSDK(const std::filesystem::path& file);
+	void CaptureSnapshot();
 
+	bool FindGlobals();
+	uintptr_t GetProcessEvent(); // Only set if "FindGlobals" had to scan for it.
 	bool Initialize(bool bCreateLog);
 	void DumpInstances(bool bNames, bool bObjects);
 	void DumpGObjects();
@@ -1,8 +1,10 @@
 #pragma once
+#ifdef _WIN32
 #include <Windows.h>
+#include <direct.h>
+#endif
 #include <inttypes.h>
 #include <stdint.h>
-#include <direct.h>
 #include <iostream>
 #include <sstream>
 #include <fstream>
@@ -12,6 +14,15 @@
 #include <filesystem>
 #include <vector>
 #include <map>
+#include <set>
+#include <unordered_map>
+#include <unordered_set>
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <shared_mutex>
 
+#ifdef _WIN32
 #include <Psapi.h>
-#pragma comment(lib, "Psapi.lib")
\ No newline at end of file
+#pragma comment(lib, "Psapi.lib")
+#endif
\ No newline at end of file